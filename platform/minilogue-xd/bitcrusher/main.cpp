@@ -1,23 +1,27 @@
 #include "usermodfx.h"
+#include "decimator.hpp"
+#include "fxbus.hpp"
 
+// Set to 1, e.g. from UDEFS, to dither before quantizing
+#ifndef BITCRUSHER_DITHER
+#define BITCRUSHER_DITHER 0
+#endif
 
-static const int SAMPLE_RATE = 48000;
+static const float SAMPLE_RATE = 48000.f;
 
-typedef struct State {
-  int bit_depth;
-  int bit_rate;
-} State;
-
-static State s_state;
+static dsp::FxBus<dsp::Decimator> s_bus;
 
 
 // Initialization function
 void MODFX_INIT(uint32_t platform, uint32_t api)
 {
-  s_state.bit_depth = 32;
-  s_state.bit_rate = SAMPLE_RATE;
+  s_bus.setPlatform(platform);
+  for (uint32_t i = 0; i < s_bus.kLanes; ++i) {
+    s_bus.lane(i).reset();
+    s_bus.lane(i).setDither(BITCRUSHER_DITHER);
+    s_bus.lane(i).setSeed(0x12345678U + i);
+  }
 
-  (void)platform;
   (void)api;
 }
 
@@ -26,43 +30,8 @@ void MODFX_PROCESS(const float *main_xn, float *main_yn,
                    const float *sub_xn, float *sub_yn,
                    uint32_t frames)
 {
-    const float * mx = main_xn;
-    float * __restrict my = main_yn;
-    const float * my_e = my + 2*frames;
-
-    const int bit_depth = s_state.bit_depth;
-    const int bit_rate = s_state.bit_rate;
-    
-    const float max_value = (float)((1 << bit_depth) - 1);
-    const int step = (int)(SAMPLE_RATE / bit_rate);
-
-    float inLeft;
-    float inRight;
-
-    float leftFirstSample;
-    float rightFirstSample;
-
-    for (; my < my_e; )
-    {
-        // Get the values from the left and right channels
-        inLeft = *(mx++);
-        inRight = *(mx++);
-
-        // Reduce the bit_rate of the current sample 
-        leftFirstSample = si_roundf((inLeft + 1.f) * max_value) / max_value - 1.f;
-        rightFirstSample = si_roundf((inRight + 1.f) * max_value) / max_value - 1.f;
- 
-        // This loop simulates down-sampling of the signal.
-        // The same sample is used in place of the `step` next samples
-        for (int j = 0; j < step && my < my_e; j++)
-        {
-            *(my++) = leftFirstSample;
-            *(my++) = rightFirstSample;
-            // move to next position in the input and output buffers
-            mx++;
-            mx++;
-        }
-    }
+    // Both buses are reduced the same way where the sub bus is used, see README
+    s_bus.process_block(main_xn, main_yn, sub_xn, sub_yn, frames);
 }
 
 
@@ -73,14 +42,23 @@ void MODFX_PARAM(uint8_t index, int32_t value)
 
     switch (index)
     {
-        // Assign a value to rate when turning the time knob
+        // Hold rate from 1Hz up to the sample rate when turning the time knob
         case k_user_modfx_param_time:
-          s_state.bit_rate = (int)((SAMPLE_RATE - 1.f)*valf + 1.f);
+          {
+            const float ratio = ((SAMPLE_RATE - 1.f)*valf + 1.f) / SAMPLE_RATE;
+            for (uint32_t i = 0; i < s_bus.kLanes; ++i)
+              s_bus.lane(i).setRate(ratio);
+          }
           break;
+        // Bit depth from 1 to 24 bits, continuously
         case k_user_modfx_param_depth:
-          s_state.bit_depth = (int)(29.f*valf + 2.f);
+          {
+            const float bits = 1.f + (dsp::Decimator::kMaxBits - 1.f)*valf;
+            for (uint32_t i = 0; i < s_bus.kLanes; ++i)
+              s_bus.lane(i).setBits(bits);
+          }
           break;
         default:
           break;
     }
-}
\ No newline at end of file
+}
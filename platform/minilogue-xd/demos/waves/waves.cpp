@@ -80,59 +80,66 @@ void OSC_CYCLE(const user_osc_param_t * const params,
   }
   
   // Temporaries.
-  float phi0 = s.phi0;
-  float phi1 = s.phi1;
-  float phisub = s.phisub;
+  dsp::PhaseAcc phase0 = s.phase0;
+  dsp::PhaseAcc phase1 = s.phase1;
+  dsp::PhaseAcc phasesub = s.phasesub;
 
   float lfoz = s.lfoz;
   const float lfo_inc = (s.lfo - lfoz) / frames;
-  
-  const float ditheramt = p.bitcrush * 2e-008f;
-  
-  const float bitres = osc_bitresf(p.bitcrush);
-  const float bitres_recip = 1.f / bitres;
 
+  // Static shape plays the blended cache, LFO sweeps scan both waves
+  const float * cache = s_waves.cache.table;
+  bool cached = false;
+  if (lfo_inc == 0.f)
+    cached = s_waves.cache.update(s.wave0, s.wave1,
+                                  clipminmaxf(0.005f, p.shape+lfoz, 0.995f),
+                                  phase1.phi - phase0.phi);
+  else
+    s_waves.cache.invalidate();
+  
   const float submix = p.submix;
   const float ringmix = p.ringmix;
   
   dsp::BiQuad &prelpf = s_waves.prelpf;
   dsp::BiQuad &postlpf = s_waves.postlpf;
+  dsp::Noise &noise = s_waves.noise;
   
   q31_t * __restrict y = (q31_t *)yn;
   const q31_t * y_e = y + frames;
   
   for (; y != y_e; ) {
 
-    const float wavemix = clipminmaxf(0.005f, p.shape+lfoz, 0.995f);
-    
-    float sig = (1.f - wavemix) * osc_wave_scanf(s.wave0, phi0);
-    sig += wavemix * osc_wave_scanf(s.wave1, phi1);
+    float sig;
+    if (cached)
+      sig = osc_wave_scanuf(cache, phase0.phi);
+    else {
+      const float wavemix = clipminmaxf(0.005f, p.shape+lfoz, 0.995f);
+      sig = (1.f - wavemix) * osc_wave_scanuf(s.wave0, phase0.phi);
+      sig += wavemix * osc_wave_scanuf(s.wave1, phase1.phi);
+    }
     
-    const float subsig = osc_wave_scanf(s.subwave, phisub);
+    const float subsig = osc_wave_scanuf(s.subwave, phasesub.phi);
     sig = (1.f - submix) * sig + submix * subsig;
     sig = (1.f - ringmix) * sig + ringmix * (subsig * sig);
     sig = clip1m1f(sig);
     
     sig = prelpf.process_fo(sig);
-    sig += s.dither * osc_white();
+    sig += s.dither * noise.white();
     sig = si_roundf(sig * s.bitres) * s.bitresrcp;
     sig = postlpf.process_fo(sig);
     sig = osc_softclipf(0.125f, sig);
     
     *(y++) = f32_to_q31(sig);
     
-    phi0 += s.w00;
-    phi0 -= (uint32_t)phi0;
-    phi1 += s.w01;
-    phi1 -= (uint32_t)phi1;
-    phisub += s.w0sub;
-    phisub -= (uint32_t)phisub;
+    phase0.cycle();
+    phase1.cycle();
+    phasesub.cycle();
     lfoz += lfo_inc;
   }
   
-  s.phi0 = phi0;
-  s.phi1 = phi1;
-  s.phisub = phisub;
+  s.phase0 = phase0;
+  s.phase1 = phase1;
+  s.phasesub = phasesub;
   s.lfoz = lfoz;
 }
 
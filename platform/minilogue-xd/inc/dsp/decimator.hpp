@@ -0,0 +1,207 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    decimator.hpp
+ * @brief   Sample rate and bit depth reduction.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+#include "phaseacc.hpp"
+#include "noise.hpp"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * Sample and hold at an arbitrary rate, followed by a uniform quantizer.
+   *
+   * A Q32 phase accumulator triggers the hold, so the average hold rate is exact for any ratio rather than
+   * an integer divisor of the sample rate. Quantization only happens when a new value is held, and uses a
+   * precomputed step and its reciprocal so that no division is needed at audio rate.
+   * One instance per channel, channels given the same settings and reset together hold on the same samples,
+   * see FxBus. All instances start from the same dither seed, use setSeed() to decorrelate them.
+   */
+  class Decimator {
+  public:
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    /** Above this depth quantization is left to float precision */
+    static constexpr float kMaxBits = 24.f;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Default constructor, full rate and depth, no dither
+     */
+    Decimator(void) :
+      mStep(0.f),
+      mStepRecip(0.f),
+      mDither(false),
+      mHold(0.f)
+    {
+      setRate(1.f);
+      setBits(kMaxBits);
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Clear held values and restart the hold phase
+     */
+    inline void reset(void)
+    {
+      mPhase.reset();
+      mHold = 0.f;
+    }
+
+    /**
+     * Set hold rate
+     *
+     * @param ratio Hold rate relative to the sample rate, in (0, 1]. 1 holds every sample.
+     */
+    inline void setRate(const float ratio)
+    {
+      mPhase.w0 = (ratio >= 1.f) ? 0xFFFFFFFFU : (uint32_t)(clip0f(ratio) * PhaseAcc::kQ32);
+    }
+
+    /**
+     * Set quantizer resolution, fractional depths give intermediate step sizes
+     *
+     * @param bits Bit depth over [-1, 1], in [1, kMaxBits]. 1 bit gives the levels -1, 0 and 1.
+     */
+    inline void setBits(const float bits)
+    {
+      const float b = clipminmaxf(1.f, bits, kMaxBits);
+      mStep = pow2f_o5(1.f - b);
+      mStepRecip = 1.f / mStep;
+    }
+
+    /**
+     * Enable TPDF dither of one step before quantization
+     */
+    inline void setDither(const bool enable)
+    {
+      mDither = enable;
+    }
+
+    /**
+     * Restart the dither noise from a seed, give each channel its own so that their dither is uncorrelated
+     *
+     * @param s Seed, any value.
+     */
+    inline void setSeed(const uint32_t s)
+    {
+      mNoise.seed(s);
+    }
+
+    /**
+     * Process one sample
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float process(const float x)
+    {
+      if (mPhase.cycleWrapped())
+        mHold = quantize(x);
+      return mHold;
+    }
+
+    /**
+     * Process a block, can be done in place
+     *
+     * @param x      Input
+     * @param y      Output
+     * @param frames Number of samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(const float *x, float *y, const uint32_t frames)
+    {
+      // Locals only in the loop, output stores could otherwise alias the members
+      uint32_t phi = mPhase.phi;
+      const uint32_t w0 = mPhase.w0;
+      float h = mHold;
+
+      const float * x_e = x + frames;
+      for (; x != x_e; ++x) {
+        phi += w0;
+        if (phi < w0)
+          h = quantize(*x);
+        *(y++) = h;
+      }
+
+      mPhase.phi = phi;
+      mHold = h;
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+  private:
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float quantize(const float x)
+    {
+      const float d = mDither ? mNoise.tpdf() : 0.f;
+      return mStep * si_roundf(x * mStepRecip + d);
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    PhaseAcc mPhase;
+    Noise    mNoise;
+    float    mStep;
+    float    mStepRecip;
+    bool     mDither;
+    float    mHold;
+  };
+}
+
+/** @} */
@@ -0,0 +1,277 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    noise.hpp
+ * @brief   Inline noise generators.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * White, TPDF, pink and brown noise from four xorshift32 lanes.
+   *
+   * Inline replacement for osc_white()/fx_white() which cost a firmware call per sample. Single sample methods
+   * use the first lane, block fills step all four lanes in parallel so that host compilers can vectorize them.
+   * Sequences are fully determined by the seed.
+   */
+  struct Noise {
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    /** Scale from int32_t to [-1, 1) */
+    static constexpr float kInt32Recip = 4.656612873077393e-10f;
+    /** Pink output gain, RMS matched to white */
+    static constexpr float kPinkGain = 0.337f;
+    /** Brown leaky integrator pole, corner at ~38Hz for 48kHz */
+    static constexpr float kBrownPole = 0.995f;
+    /** Brown input gain, RMS matched to white, sqrt(1 - pole^2) */
+    static constexpr float kBrownGain = 0.0998749f;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Constructor
+     *
+     * @param s Seed, any value.
+     */
+    Noise(const uint32_t s = 0x12345678U)
+    {
+      seed(s);
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Restart all lanes and filter states from a seed
+     *
+     * @param s Seed, any value.
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void seed(uint32_t s)
+    {
+      for (uint32_t i = 0; i < 4; ++i) {
+        // Spread seed over lanes, xorshift state must be non zero
+        s = s * 1664525U + 1013904223U;
+        mS[i] = (s ^ (s >> 16)) | 1U;
+      }
+      mP0 = mP1 = mP2 = mB = 0.f;
+    }
+
+    /**
+     * Raw 32-bit random value
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    uint32_t u32(void)
+    {
+      return mS[0] = step(mS[0]);
+    }
+
+    /**
+     * White noise, uniform in [-1, 1)
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float white(void)
+    {
+      return kInt32Recip * (float)(int32_t)u32();
+    }
+
+    /**
+     * Triangular PDF noise in (-1, 1), for dithering
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float tpdf(void)
+    {
+      const uint32_t r = u32();
+      mS[1] = step(mS[1]);
+      return kInt32Recip * (float)(((int32_t)r >> 1) + ((int32_t)mS[1] >> 1));
+    }
+
+    /**
+     * Pink noise, -3dB/octave from ~10Hz (Paul Kellet's economy filter)
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float pink(void)
+    {
+      return pinkFilter(white());
+    }
+
+    /**
+     * Brown noise, -6dB/octave above ~38Hz
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float brown(void)
+    {
+      return brownFilter(white());
+    }
+
+    /**
+     * Fill a buffer with white noise
+     *
+     * @param y      Output buffer
+     * @param frames Number of samples
+     * @param gain   Output gain
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void white_block(float * __restrict y, const uint32_t frames, const float gain = 1.f)
+    {
+      const float g = gain * kInt32Recip;
+      uint32_t s0 = mS[0], s1 = mS[1], s2 = mS[2], s3 = mS[3];
+      const float * y_e = y + (frames & ~3U);
+      for (; y != y_e; y += 4) {
+        s0 = step(s0); s1 = step(s1); s2 = step(s2); s3 = step(s3);
+        y[0] = g * (float)(int32_t)s0;
+        y[1] = g * (float)(int32_t)s1;
+        y[2] = g * (float)(int32_t)s2;
+        y[3] = g * (float)(int32_t)s3;
+      }
+      mS[0] = s0; mS[1] = s1; mS[2] = s2; mS[3] = s3;
+      for (y_e += frames & 3U; y != y_e; )
+        *(y++) = gain * white();
+    }
+
+    /**
+     * Fill a buffer with TPDF noise
+     *
+     * @param y      Output buffer
+     * @param frames Number of samples
+     * @param gain   Output gain, e.g. one LSB of the target resolution
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void tpdf_block(float * __restrict y, const uint32_t frames, const float gain = 1.f)
+    {
+      const float g = gain * kInt32Recip;
+      uint32_t s0 = mS[0], s1 = mS[1], s2 = mS[2], s3 = mS[3];
+      const float * y_e = y + (frames & ~1U);
+      for (; y != y_e; y += 2) {
+        s0 = step(s0); s1 = step(s1); s2 = step(s2); s3 = step(s3);
+        y[0] = g * (float)(((int32_t)s0 >> 1) + ((int32_t)s1 >> 1));
+        y[1] = g * (float)(((int32_t)s2 >> 1) + ((int32_t)s3 >> 1));
+      }
+      mS[0] = s0; mS[1] = s1; mS[2] = s2; mS[3] = s3;
+      if (frames & 1U)
+        *y = gain * tpdf();
+    }
+
+    /**
+     * Fill a buffer with pink noise
+     *
+     * @param y      Output buffer
+     * @param frames Number of samples
+     * @param gain   Output gain
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void pink_block(float * __restrict y, const uint32_t frames, const float gain = 1.f)
+    {
+      white_block(y, frames);
+      const float * y_e = y + frames;
+      for (; y != y_e; ++y)
+        *y = gain * pinkFilter(*y);
+    }
+
+    /**
+     * Fill a buffer with brown noise
+     *
+     * @param y      Output buffer
+     * @param frames Number of samples
+     * @param gain   Output gain
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void brown_block(float * __restrict y, const uint32_t frames, const float gain = 1.f)
+    {
+      white_block(y, frames);
+      const float * y_e = y + frames;
+      for (; y != y_e; ++y)
+        *y = gain * brownFilter(*y);
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+    /**
+     * xorshift32 step, period 2^32-1
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    uint32_t step(uint32_t x)
+    {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      return x;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float pinkFilter(const float w)
+    {
+      mP0 = 0.99765f * mP0 + 0.0990460f * w;
+      mP1 = 0.96300f * mP1 + 0.2965164f * w;
+      mP2 = 0.57000f * mP2 + 1.0526913f * w;
+      return kPinkGain * (mP0 + mP1 + mP2 + 0.1848f * w);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float brownFilter(const float w)
+    {
+      mB = kBrownPole * mB + kBrownGain * w;
+      return mB;
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    uint32_t mS[4];
+    float    mP0, mP1, mP2;
+    float    mB;
+  };
+}
+
+/** @} */
@@ -44,6 +44,11 @@
  * @{
  */
 
+extern "C" {
+  /** Firmware sine half-period table, as declared in osc_api.h and fx_api.h */
+  extern const float wt_sine_lut_f[];
+}
+
 /**
  * Common DSP Utilities
  */
@@ -79,7 +84,7 @@ namespace dsp {
     inline __attribute__((optimize("Ofast"),always_inline))
     void cycle(void)
     {
-      phi0 += w0;
+      phi0 = (q31_t)((uint32_t)phi0 + (uint32_t)w0);
     }
 
     /**
@@ -115,12 +120,75 @@ namespace dsp {
     }
     
     // --- Sinusoids --------------
+    //
+    // Linearly interpolated lookups in the firmware sine table, max error ~7.5e-5.
+
+    /**
+     * Lookup sine from firmware table
+     *
+     * @param x Phase in [0, 2^32) mapped to [0, 1)
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float sine_lut(const uint32_t x)
+    {
+      const uint32_t x0p = x >> 24;
+      const uint32_t x0 = x0p & 0x7F;
+      const float fr = 5.96046447753906e-008f * (float)(x & 0xFFFFFF);
+      // half period stored, second half negated by flipping the sign bit
+      f32_t y0 = { linintf(fr, wt_sine_lut_f[x0], wt_sine_lut_f[x0 + 1]) };
+      y0.i ^= (x0p >> 7) << 31;
+      return y0.f;
+    }
 
     /**
      * Get value of bipolar sine wave for current phase 
      */
     inline __attribute__((optimize("Ofast"),always_inline))
     float sine_bi(void) 
+    {
+      return sine_lut((uint32_t)phi0 + 0x80000000U);
+    }          
+
+    /**
+     * Get value of positive unipolar sine wave for current phase 
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float sine_uni(void) 
+    {
+      return 0.5f + 0.5f * sine_lut((uint32_t)phi0 + 0x80000000U);
+    }          
+
+    /**
+     * Get current value of bipolar sine wave for phase with offset
+     *
+     * @param offset Offset to apply to current phase, in [-1, 1]
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float sine_bi_off(const float offset) 
+    {
+      return sine_lut((uint32_t)phi0 + 0x80000000U + (((uint32_t)f32_to_q31(offset)) << 1));
+    }          
+
+    /**
+     * Get current value of positive unipolar sine wave for phase with offset
+     *
+     * @param offset Offset to apply to current phase, in [-1, 1]
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float sine_uni_off(const float offset) 
+    {
+      return 0.5f + 0.5f * sine_lut((uint32_t)phi0 + 0x80000000U + (((uint32_t)f32_to_q31(offset)) << 1));
+    }          
+
+    // --- Sinusoids, parabolic approximation --------------
+    //
+    // No table access, max error ~5.6e-2.
+
+    /**
+     * Get value of bipolar sine wave for current phase 
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float sine_bi_fast(void) 
     {
       const float phif = q31_to_f32(phi0);
       return 4 * phif * (si_fabsf(phif) - 1.f);
@@ -130,7 +198,7 @@ namespace dsp {
      * Get value of positive unipolar sine wave for current phase 
      */
     inline __attribute__((optimize("Ofast"),always_inline))
-    float sine_uni(void) 
+    float sine_uni_fast(void) 
     {
       const float phif = q31_to_f32(phi0);
       return 0.5f + 2 * phif * (si_fabsf(phif) - 1.f);
@@ -142,7 +210,7 @@ namespace dsp {
      * @param offset Offset to apply to current phase, in [-1, 1]
      */
     inline __attribute__((optimize("Ofast"),always_inline))
-    float sine_bi_off(const float offset) 
+    float sine_bi_off_fast(const float offset) 
     {
       const float phi = q31_to_f32(phi0 + f32_to_q31(2*offset));
       return 4 * phi * (si_fabsf(phi) - 1.f);
@@ -154,7 +222,7 @@ namespace dsp {
      * @param offset Offset to apply to current phase, in [-1, 1]
      */
     inline __attribute__((optimize("Ofast"),always_inline))
-    float sine_uni_off(const float offset) 
+    float sine_uni_off_fast(const float offset) 
     {
       const float phi = q31_to_f32(phi0 + f32_to_q31(2*offset));
       return 0.5f + 2 * phi * (si_fabsf(phi) - 1.f);
@@ -290,7 +358,194 @@ namespace dsp {
       const q31_t phi = phi0 + (f32_to_q31(offset)<<1);
       return (phi < 0) ? 0.f : 1.f;
     }
-      
+
+    // --- Band-limited (PolyBLEP) --------------
+    //
+    // Suitable for audio rate use. The correction residual is only evaluated
+    // for samples within one phase increment of a discontinuity, w0 must be
+    // positive and below Nyquist.
+
+    /**
+     * PolyBLEP residual for a unit (+2) step
+     *
+     * @param d Signed phase distance to discontinuity, |d| < w
+     * @param wrecip Reciprocal of phase increment
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float polyblep(const q31_t d, const float wrecip)
+    {
+      const float x = (float)d * wrecip;
+      const float r = 1.f - si_fabsf(x);
+      return (d < 0) ? -r*r : r*r;
+    }
+
+    /**
+     * Check if phase is within one increment of a discontinuity
+     *
+     * @param d Signed phase distance to discontinuity
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    bool near_edge(const q31_t d) const
+    {
+      return ((uint32_t)d + (uint32_t)w0) < ((uint32_t)w0 << 1);
+    }
+
+    /**
+     * Get current value of band-limited bipolar saw wave for current phase
+     *
+     * @param wrecip Reciprocal of phase increment, see getW0Recip()
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float saw_bi_bl(const float wrecip)
+    {
+      const q31_t d = phi0 ^ 0x80000000;
+      const float y = q31_to_f32(phi0);
+      return near_edge(d) ? y + polyblep(d, wrecip) : y;
+    }
+
+    /**
+     * Get current value of band-limited bipolar saw wave for current phase
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float saw_bi_bl(void)
+    {
+      const q31_t d = phi0 ^ 0x80000000;
+      const float y = q31_to_f32(phi0);
+      return near_edge(d) ? y + polyblep(d, getW0Recip()) : y;
+    }
+
+    /**
+     * Get current value of band-limited bipolar pulse wave for current phase
+     *
+     * @param width Pulse width in (0, 1), portion of the period spent at 1.f
+     * @param wrecip Reciprocal of phase increment, see getW0Recip()
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float pulse_bi_bl(const float width, const float wrecip)
+    {
+      const q31_t th = f32_to_q31(1.f - 2.f * width);
+      const q31_t d0 = phi0 ^ 0x80000000;
+      const q31_t d1 = (q31_t)((uint32_t)phi0 - (uint32_t)th);
+      float y = (phi0 < th) ? -1.f : 1.f;
+      if (near_edge(d0))
+        y += polyblep(d0, wrecip);
+      if (near_edge(d1))
+        y -= polyblep(d1, wrecip);
+      return y;
+    }
+
+    /**
+     * Get current value of band-limited bipolar pulse wave for current phase
+     *
+     * @param width Pulse width in (0, 1), portion of the period spent at 1.f
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float pulse_bi_bl(const float width)
+    {
+      const q31_t th = f32_to_q31(1.f - 2.f * width);
+      const q31_t d0 = phi0 ^ 0x80000000;
+      const q31_t d1 = (q31_t)((uint32_t)phi0 - (uint32_t)th);
+      float y = (phi0 < th) ? -1.f : 1.f;
+      if (near_edge(d0))
+        y += polyblep(d0, getW0Recip());
+      if (near_edge(d1))
+        y -= polyblep(d1, getW0Recip());
+      return y;
+    }
+
+    /**
+     * Get current value of band-limited bipolar square wave for current phase
+     *
+     * @param wrecip Reciprocal of phase increment, see getW0Recip()
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float square_bi_bl(const float wrecip)
+    {
+      const q31_t d0 = phi0 ^ 0x80000000;
+      float y = (phi0 < 0) ? -1.f : 1.f;
+      if (near_edge(d0))
+        y += polyblep(d0, wrecip);
+      if (near_edge(phi0))
+        y -= polyblep(phi0, wrecip);
+      return y;
+    }
+
+    /**
+     * Get current value of band-limited bipolar square wave for current phase
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float square_bi_bl(void)
+    {
+      const q31_t d0 = phi0 ^ 0x80000000;
+      float y = (phi0 < 0) ? -1.f : 1.f;
+      if (near_edge(d0))
+        y += polyblep(d0, getW0Recip());
+      if (near_edge(phi0))
+        y -= polyblep(phi0, getW0Recip());
+      return y;
+    }
+
+    /**
+     * Step phase and write band-limited bipolar saw wave to buffer
+     *
+     * @param y Output buffer
+     * @param frames Number of samples to write
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void saw_bi_bl_block(float * __restrict y, const uint32_t frames)
+    {
+      const float wrecip = getW0Recip();
+      const float * y_e = y + frames;
+      for (; y != y_e; ) {
+        cycle();
+        *(y++) = saw_bi_bl(wrecip);
+      }
+    }
+
+    /**
+     * Step phase and write band-limited bipolar pulse wave to buffer
+     *
+     * @param y Output buffer
+     * @param frames Number of samples to write
+     * @param width Pulse width in (0, 1), portion of the period spent at 1.f
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void pulse_bi_bl_block(float * __restrict y, const uint32_t frames, const float width)
+    {
+      const float wrecip = getW0Recip();
+      const float * y_e = y + frames;
+      for (; y != y_e; ) {
+        cycle();
+        *(y++) = pulse_bi_bl(width, wrecip);
+      }
+    }
+
+    /**
+     * Step phase and write band-limited bipolar square wave to buffer
+     *
+     * @param y Output buffer
+     * @param frames Number of samples to write
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void square_bi_bl_block(float * __restrict y, const uint32_t frames)
+    {
+      const float wrecip = getW0Recip();
+      const float * y_e = y + frames;
+      for (; y != y_e; ) {
+        cycle();
+        *(y++) = square_bi_bl(wrecip);
+      }
+    }
+
+    /**
+     * Get reciprocal of phase increment, used by band-limited waves
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float getW0Recip(void) const
+    {
+      return 1.f / (float)(uint32_t)w0;
+    }
+
     /*===========================================================================*/
     /* Members Vars                                                              */
     /*===========================================================================*/
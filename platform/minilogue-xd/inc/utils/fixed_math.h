@@ -226,6 +226,36 @@ simd32_t q15minp(simd32_t a, simd32_t b) {
 
 /** @} */
 
+/**
+ * @name   Q15 table interpolation.
+ * @note   Tables must provide a guard point so that p[1] is readable at the last index.
+ * @{
+ */
+
+/** Fraction bits expected by q15_linint_pair(), both weights must fit in a signed halfword */
+#define k_q15_linint_fr_bits  14
+/** Scale from q15_linint_pair() result to [-1, 1) float */
+#define k_q15_linint_recipf   (1.f / (float)(1U<<(15 + k_q15_linint_fr_bits)))
+
+/** Linear interpolation between two adjacent Q15 samples
+ * @param p  Pointer to first sample, may be unaligned
+ * @param fr Fraction in Q14, [0, 0x4000]
+ * @return Interpolated value in Q29
+ * @note On Cortex-M4 both samples are fetched with a single word load and weighted with SMUAD.
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+int32_t q15_linint_pair(const q15_t *p, const uint32_t fr) {
+#if defined(__ARM_ARCH_7EM__)
+  simd32_t pair;
+  __builtin_memcpy(&pair, p, sizeof(pair)); // LDR, unaligned access is allowed on v7-M
+  return smuad(pair, (simd32_t)((fr << 16) | ((1U<<k_q15_linint_fr_bits) - fr)));
+#else
+  return (int32_t)p[0] * (int32_t)((1U<<k_q15_linint_fr_bits) - fr) + (int32_t)p[1] * (int32_t)fr;
+#endif
+}
+
+/** @} */
+
 /**
  * @name   Q31.
  * @note   Some arguments are used multiple times, make sure not to pass expressions.
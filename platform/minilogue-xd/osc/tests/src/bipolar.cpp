@@ -39,12 +39,12 @@
  */
 
 #include "userosc.h"
+#include "phaseacc.hpp"
 
 typedef __uint32_t uint32_t;
 
 typedef struct State {
-  float w0;
-  float phase;
+  dsp::PhaseAcc phase;
   float drive;
   float harmonic;
   float dist;
@@ -61,8 +61,7 @@ enum {
 
 void OSC_INIT(uint32_t platform, uint32_t api)
 {
-  s_state.w0    = 0.f;
-  s_state.phase = 0.f;
+  s_state.phase = dsp::PhaseAcc();
   s_state.drive = 1.f;
   s_state.harmonic = 0.f;
   s_state.dist  = 0.f;
@@ -77,8 +76,10 @@ void OSC_CYCLE(const user_osc_param_t * const params,
   const uint8_t flags = s_state.flags;
   s_state.flags = k_flags_none;
   
-  const float w0 = s_state.w0 = osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF);
-  float phase = (flags & k_flag_reset) ? 0.f : s_state.phase;
+  dsp::PhaseAcc phase = s_state.phase;
+  phase.setW0(osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF));
+  if (flags & k_flag_reset)
+    phase.reset();
   
   const float drive = s_state.drive;
   const float harmonic = 0.5f * s_state.harmonic;
@@ -96,20 +97,18 @@ void OSC_CYCLE(const user_osc_param_t * const params,
     const float dist_mod = dist + lfoz * dist;
     
     // Phase distortion
-    float p = phase + linintf(dist_mod, 0.f, dist_mod * osc_sinf(phase));
-    p = (p <= 0) ? 1.f - p : p - (uint32_t)p;
+    const uint32_t p = phase.getPhaseOff(linintf(dist_mod, 0.f, dist_mod * osc_sinuf(phase.phi)));
     
     // Main signal
-    float sig  = drive * osc_sinf(p);
+    float sig  = drive * osc_sinuf(p);
 
     // Add harmonic
-    sig = osc_softclipf(0.05f, fundamental * sig + harmonic * osc_sinf(4*phase));
+    sig = osc_softclipf(0.05f, fundamental * sig + harmonic * osc_sinuf(phase.phi << 2));
 
     // Write to output buffer in Q31
     *(y++) = f32_to_q31(sig);
     
-    phase += w0;
-    phase -= (uint32_t)phase;
+    phase.cycle();
 
     lfoz += lfo_inc;
   }
@@ -39,11 +39,11 @@
  */
 
 #include "userosc.h"
+#include "phaseacc.hpp"
 
 typedef __uint32_t uint32_t;
 typedef struct State {
-  float w0;
-  float phase;
+  dsp::PhaseAcc phase;
   float drive;
   float dist;
   float lfo, lfoz;
@@ -59,8 +59,7 @@ enum {
 
 void OSC_INIT(uint32_t platform, uint32_t api)
 {
-  s_state.w0    = 0.f;
-  s_state.phase = 0.f;
+  s_state.phase = dsp::PhaseAcc();
   s_state.drive = 1.f;
   s_state.dist  = 0.f;
   s_state.lfo = s_state.lfoz = 0.f;
@@ -74,8 +73,10 @@ void OSC_CYCLE(const user_osc_param_t * const params,
   const uint8_t flags = s_state.flags;
   s_state.flags = k_flags_none;
   
-  const float w0 = s_state.w0 = osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF);
-  float phase = (flags & k_flag_reset) ? 0.f : s_state.phase;
+  dsp::PhaseAcc phase = s_state.phase;
+  phase.setW0(osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF));
+  if (flags & k_flag_reset)
+    phase.reset();
   
   const float drive = s_state.drive;
   const float dist  = s_state.dist;
@@ -91,15 +92,13 @@ void OSC_CYCLE(const user_osc_param_t * const params,
     const float dist_mod = dist + lfoz * dist;
     
     // Phase distortion
-    float p = phase + linintf(dist_mod, 0.f, dist_mod * osc_sinf(phase));
-    p = (p <= 0) ? 1.f - p : p - (uint32_t)p;
+    const uint32_t p = phase.getPhaseOff(linintf(dist_mod, 0.f, dist_mod * osc_sinuf(phase.phi)));
 
     // Main signal
-    const float sig  = osc_softclipf(0.05f, drive * osc_sinf(p));
+    const float sig  = osc_softclipf(0.05f, drive * osc_sinuf(p));
     *(y++) = f32_to_q31(sig);
     
-    phase += w0;
-    phase -= (uint32_t)phase;
+    phase.cycle();
 
     lfoz += lfo_inc;
   }
@@ -39,12 +39,12 @@
  */
 
 #include "userosc.h"
+#include "phaseacc.hpp"
 
 typedef __uint32_t uint32_t;
 
 typedef struct State {
-  float w0;
-  float phase;
+  dsp::PhaseAcc phase;
   float duty;
   float angle;
   float lfo, lfoz;
@@ -60,8 +60,7 @@ static State s_state;
 
 void OSC_INIT(uint32_t platform, uint32_t api)
 {
-  s_state.w0    = 0.f;
-  s_state.phase = 0.f;
+  s_state.phase = dsp::PhaseAcc();
   s_state.duty  = 0.1f;
   s_state.angle = 0.f;
   s_state.lfo = s_state.lfoz = 0.f;
@@ -75,8 +74,10 @@ void OSC_CYCLE(const user_osc_param_t * const params,
   const uint8_t flags = s_state.flags;
   s_state.flags = k_flags_none;
     
-  const float w0 = s_state.w0 = osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF);
-  float phase = (flags & k_flag_reset) ? 0.f : s_state.phase;
+  dsp::PhaseAcc phase = s_state.phase;
+  phase.setW0(osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF));
+  if (flags & k_flag_reset)
+    phase.reset();
   
   const float duty = s_state.duty;
   const float angle = s_state.angle;
@@ -91,14 +92,14 @@ void OSC_CYCLE(const user_osc_param_t * const params,
   for (; y != y_e; ) {
     const float pwm = clipminmaxf(0.1f, duty + lfoz, 0.9f);
 
-    float sig = (phase - pwm <= 0.f) ? 1.f : -1.f;
+    const float phasef = phase.getPhasef();
+    float sig = (phasef - pwm <= 0.f) ? 1.f : -1.f;
 
-    sig *= 1.f - (angle * phase);
+    sig *= 1.f - (angle * phasef);
 
     *(y++) = f32_to_q31(sig);
 
-    phase += w0;
-    phase -= (uint32_t)phase;
+    phase.cycle();
 
     lfoz += lfo_inc;
   }
@@ -36,48 +36,53 @@
  *
  * Van der Pol Oscillator
  * 
- * Solve Van der Pol equation using the fourth Order Runge-Kutta method.
- *   
  * Solves the equation system
  *   x' = y
- *   y' = mu (1 - x^2) y - alpha x
- * where mu controls the daming, and alpha controls the oscillations frequency.  
+ *   y' = mu (1 - x^2) y - w0^2 x
+ * where mu controls the damping, and w0 the oscillation frequency.
+ *
+ * The equation is stiff for large mu and high notes, so it is integrated with the linearly implicit
+ * trapezoidal rule (dsp::OdeTrapezoidal<1>), which stays stable over the whole parameter range at one
+ * step per sample. Define VDPOL_OVERSAMPLING to 2 to run two half steps per sample for tighter tuning.
  * 
  * https://en.wikipedia.org/wiki/Van_der_Pol_oscillator
- * https://en.wikipedia.org/wiki/Runge%E2%80%93Kutta_methods
+ * https://en.wikipedia.org/wiki/Trapezoidal_rule_(differential_equations)
  */
 
 #include "userosc.h"
-#define SAMPLING_FREQUENCY 48000
+#include "ode.hpp"
+
+#ifndef VDPOL_OVERSAMPLING
+#define VDPOL_OVERSAMPLING 1
+#endif
+
+#define VDPOL_CHUNK_SIZE 64
+
+typedef dsp::OdeOsc<dsp::OdeVanDerPol, dsp::OdeTrapezoidal<1>, VDPOL_OVERSAMPLING> Oscillator;
 
 typedef struct State {
-  float w0;
-  float x;
-  float y;
+  Oscillator osc;
   float mu;
   uint8_t flags;
 } State;
 
 static State s_state;
+static float s_buffer[VDPOL_CHUNK_SIZE * VDPOL_OVERSAMPLING];
 
 enum {
   k_flags_none = 0,
   k_flag_reset = 1<<0,
 };
 
+static const float s_x0[2] = { 1.f, 0.f };
+
 void OSC_INIT(uint32_t platform, uint32_t api)
 {
-  s_state.w0 = 0.f;
-  s_state.x = 1.f;
-  s_state.y = 1.f;
+  s_state.osc.reset(s_x0);
   s_state.mu  = 0.f;
   s_state.flags = k_flags_none;
 }
 
-float g(float x, float y, float mu, float alpha) {
-  return mu*(1 - x*x)*y - alpha*x;
-}
-
 void OSC_CYCLE(const user_osc_param_t * const params,
                int32_t *yn,
                const uint32_t frames)
@@ -85,45 +90,28 @@ void OSC_CYCLE(const user_osc_param_t * const params,
   const uint8_t flags = s_state.flags;
   s_state.flags = k_flags_none;
 
-  float x = (flags & k_flag_reset) ? 1.f : s_state.x;
-  float y = (flags & k_flag_reset) ? 1.f : s_state.y;
+  Oscillator &osc = s_state.osc;
+  if (flags & k_flag_reset)
+    osc.reset(s_x0);
 
-  const float w0 = 2.0f*PI*osc_notehzf((params->pitch)>>8);
-  const float alpha = w0*w0;
-  const float mu = s_state.mu;
-  // Time step h is set as the sampling time 
-  const float h = 1.0f / SAMPLING_FREQUENCY;
-
-  float k0, l0, k1, l1, k2, l2, k3, l3;
+  osc.setW0(osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF));
+  // mu is given per second, the model works in samples
+  osc.model().setMu(s_state.mu * (1.f / k_samplerate));
   
   q31_t * __restrict z = (q31_t *)yn;
-  const q31_t * z_e = z + frames;
   
-  for (; z != z_e; ) {
-    // Perform a step of Runge–Kutta fourth-order method
-    // for every sample
-    k0 = h*y;
-    l0 = h*g(x, y, mu, alpha);
-
-    k1 = h*(y + 0.5f*l0);
-    l1 = h*g(x + 0.5f*k0, y + 0.5f*l0, mu, alpha);
-
-    k2 = h*(y + 0.5f*l1);
-    l2 = h*g(x + 0.5f*k1, y + 0.5f*l1, mu, alpha);
-
-    k3 = h*(y + l2);
-    l3 = h*g(x + k2, y + l2, mu, alpha);
-
-    x = x + (1.0f / 6.0f)*(k0 + 2.0f*k1 + 2.0f*k2 + k3);
-    y = y + (1.0f / 6.0f)*(l0 + 2.0f*l1 + 2.0f*l2 + l3);
-
-    // Set the current sample
-    const float sig  = osc_softclipf(0.05f, 0.5f*x);
-    *(z++) = f32_to_q31(sig);
+  for (uint32_t remain = frames; remain; ) {
+    const uint32_t n = (remain < VDPOL_CHUNK_SIZE) ? remain : VDPOL_CHUNK_SIZE;
+    osc.process_block(s_buffer, n);
+    remain -= n;
+
+    const float * x = s_buffer;
+    const float * x_e = x + n;
+    for (; x != x_e; ) {
+      const float sig  = osc_softclipf(0.05f, 0.5f * *(x++));
+      *(z++) = f32_to_q31(sig);
+    }
   }
-
-  s_state.x = x;
-  s_state.y = y;
 }
 
 void OSC_NOTEON(const user_osc_param_t * const params)
@@ -36,18 +36,27 @@
  *
  * Wavetable oscillator
  *
+ * Scans a per-octave mipmap with a Q32 phase, index and fraction being plain shifts. Each sample is read from
+ * two adjacent mip rows with the same index and fraction, and the rows are crossfaded over the last
+ * XFADE_NOTES semitones of each row's range so that moving across octaves does not switch audibly.
+ *
  */
 
 #include "userosc.h"
-#include "math.h"
+#include "phaseacc.hpp"
 #include <wavetable.h>
 
-static const float INDEX_INCREMENT = 1.f / CYCLE_SIZE;
+// Q32 phase split into table index (top bits) and Q14 interpolation fraction
+static const uint32_t CYCLE_SIZE_EXP = 8;
+static const uint32_t INDEX_SHIFT = 32 - CYCLE_SIZE_EXP;
+static const uint32_t FRAC_SHIFT = INDEX_SHIFT - k_q15_linint_fr_bits;
+
+// Semitones at the top of a row's range over which it fades into the next row
+static const float XFADE_NOTES = 3.f;
 
 typedef struct State {
-  float w0;
-  float phase;
-  float lfo, lfoz;
+  dsp::PhaseAcc phase;
+  float xfade;
   uint8_t flags;
 } State;
 
@@ -59,33 +68,22 @@ enum {
 };
 
 
-// Convert a note to the corrent index
-// to be used in the MIPMAP table
-int note_to_index(uint8_t note) {
-    float ix_scaled = ((float)note - NOTE_OFFSET) / NOTE_INCREMENT;
-    int index = (int)clipminmaxf(0, ix_scaled, N_ROWS - 1);
-    return index;
-}
-
-
-float osc_wavetable(float phase, int row_index) {
-  int ix_1 = (int)floor(phase * CYCLE_SIZE);
-  int ix_2 = (ix_1 + 1) % CYCLE_SIZE;       
-  
-  float y_lo = table[row_index][ix_1];
-  float y_hi = table[row_index][ix_2];
-
-  float x_lo = ix_1 * INDEX_INCREMENT;
-  float slope = (y_hi - y_lo) / INDEX_INCREMENT;
-  return slope*(phase - x_lo) + y_lo;
+// Mip row and crossfade amount toward the next row for a pitch
+// given as note in the upper byte and fine pitch in the lower byte
+static inline __attribute__((optimize("Ofast"),always_inline))
+uint32_t pitch_to_row(uint16_t pitch, float *xfade) {
+  const float note = clipminf(0.f, (float)pitch * (1.f / 256.f) - NOTE_OFFSET);
+  const float pos = clipmaxf(note * (1.f / NOTE_INCREMENT), N_ROWS - 1);
+  const uint32_t row = (uint32_t)pos;
+  *xfade = clip01f(((pos - row) * NOTE_INCREMENT - (NOTE_INCREMENT - XFADE_NOTES)) * (1.f / XFADE_NOTES));
+  return row;
 }
 
 
 void OSC_INIT(uint32_t platform, uint32_t api)
 {
-  s_state.w0    = 0.f;
-  s_state.phase = 0.f;
-  s_state.lfo = s_state.lfoz = 0.f;
+  s_state.phase = dsp::PhaseAcc();
+  s_state.xfade = 0.f;
   s_state.flags = k_flags_none;
 }
 
@@ -96,33 +94,44 @@ void OSC_CYCLE(const user_osc_param_t * const params,
 {  
   const uint8_t flags = s_state.flags;
   s_state.flags = k_flags_none;
-  
-  const uint8_t note = (params->pitch)>>8;
-  const int row_index = note_to_index(note);
 
-  const float w0 = s_state.w0 = osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF);
-  float phase = (flags & k_flag_reset) ? 0.f : s_state.phase;
-  
-  const float lfo = s_state.lfo = q31_to_f32(params->shape_lfo);
-  float lfoz = (flags & k_flag_reset) ? lfo : s_state.lfoz;
-  const float lfo_inc = (lfo - lfoz) / frames;
+  float xfade;
+  const uint32_t row = pitch_to_row(params->pitch, &xfade);
+  const int16_t * __restrict a = table[row];
+  const int16_t * __restrict b = table[clipmaxu32(row + 1, N_ROWS - 1)];
+
+  // Ramp the crossfade across the block, restarting from the target on a row change or reset
+  float xf = s_state.xfade;
+  if ((flags & k_flag_reset) || si_fabsf(xfade - xf) > 0.5f)
+    xf = xfade;
+  const float xf_inc = (xfade - xf) / frames;
+  s_state.xfade = xfade;
+
+  dsp::PhaseAcc phase = s_state.phase;
+  phase.setW0(osc_w0f_for_note((params->pitch)>>8, params->pitch & 0xFF));
+  if (flags & k_flag_reset)
+    phase.reset();
+
+  // Locals only in the loop, Q31 stores could otherwise alias the phase
+  uint32_t phi = phase.phi;
+  const uint32_t w0 = phase.w0;
   
   q31_t * __restrict y = (q31_t *)yn;
   const q31_t * y_e = y + frames;
   
   for (; y != y_e; ) {
-    // Main signal
-    const float sig = osc_wavetable(phase, row_index);
-    *(y++) = f32_to_q31(sig);
+    const uint32_t ix = phi >> INDEX_SHIFT;
+    const uint32_t fr = (phi >> FRAC_SHIFT) & ((1U << k_q15_linint_fr_bits) - 1);
+    const float ya = (float)q15_linint_pair(a + ix, fr);
+    const float yb = (float)q15_linint_pair(b + ix, fr);
+    *(y++) = f32_to_q31(k_q15_linint_recipf * linintf(xf, ya, yb));
     
-    phase += w0;
-    phase -= (uint32_t)phase;
-
-    lfoz += lfo_inc;
+    phi += w0;
+    xf += xf_inc;
   }
   
+  phase.phi = phi;
   s_state.phase = phase;
-  s_state.lfoz = lfoz;
 }
 
 void OSC_NOTEON(const user_osc_param_t * const params)
@@ -1,16 +1,17 @@
 // MIPMAP Table for wavetable oscillator
+// Q15 samples, each row followed by a guard point equal to its first sample
 static const int N_ROWS = 9;
 static const int CYCLE_SIZE = 256;
 static const int NOTE_OFFSET = 24;
 static const int NOTE_INCREMENT = 12;
-static const float table [9][256] = {
-    {-0.0048217773437499965, 0.006713867187499948, 0.013793945312499993, -0.006408691406249993, -0.05752563476562491, -0.11145019531250004, -0.132354736328125, -0.11621093749999997, -0.09869384765624994, -0.11758422851562503, -0.17248535156250008, -0.2317199707031249, -0.27862548828125006, -0.3366394042968751, -0.438262939453125, -0.575775146484375, -0.699615478515625, -0.76910400390625, -0.7925415039062501, -0.8090820312499999, -0.8402099609375, -0.8744201660156252, -0.898040771484375, -0.9206848144531249, -0.95654296875, -0.9902343749999999, -0.982635498046875, -0.9176940917968749, -0.832061767578125, -0.783203125, -0.7875976562500001, -0.800628662109375, -0.7650146484375, -0.6758422851562499, -0.5904541015625002, -0.57049560546875, -0.61883544921875, -0.678680419921875, -0.695220947265625, -0.6711730957031249, -0.656707763671875, -0.687835693359375, -0.7445068359375002, -0.7740478515625, -0.7495117187500001, -0.69610595703125, -0.6607971191406248, -0.6639404296875, -0.6862182617187501, -0.6964111328124999, -0.6837158203125, -0.66387939453125, -0.6615295410156251, -0.6895141601562502, -0.73822021484375, -0.776336669921875, -0.76568603515625, -0.687286376953125, -0.562286376953125, -0.4428710937499999, -0.3737792968749999, -0.3564453124999999, -0.3533935546874999, -0.32901000976562494, -0.28366088867187506, -0.24472045898437503, -0.22885131835937486, -0.22058105468750006, -0.1904907226562501, -0.12896728515625017, -0.056182861328125, -0.0025634765624999445, 0.01422119140625, -0.00634765625, -0.055694580078125, -0.12011718749999989, -0.1809387207031249, -0.22103881835937497, -0.23654174804687472, -0.23806762695312494, -0.23583984375, -0.2250366210937499, -0.19061279296874978, -0.1280517578124999, -0.05572509765625017, -0.0039062500000001665, 0.008026123046874889, -0.016784667968749833, -0.06182861328125017, -0.11413574218749997, -0.1712341308593751, -0.23333740234375, -0.29266357421875006, -0.334320068359375, -0.348968505859375, -0.34323120117187494, -0.33477783203125, -0.3356628417968751, -0.3421630859374999, -0.34341430664062517, -0.3372497558593751, -0.33322143554687533, -0.3380737304687501, -0.344573974609375, -0.34030151367187506, -0.3273010253906251, -0.3248901367187501, -0.349273681640625, -0.3936462402343752, -0.4345703125, -0.4558410644531249, -0.4598388671875, -0.4544677734375001, -0.4373779296875, -0.39987182617187494, -0.342987060546875, -0.28063964843750006, -0.22445678710937506, -0.17175292968749994, -0.11398315429687497, -0.05392456054687493, -0.007751464843749903, 0.011016845703125028, 0.006011962890625021, -0.0053710937499999965, -0.007812499999999934, 9.155273437499371e-05, 0.007965087890624993, 0.00540161132812499, -0.006011962890624962, -0.010925292968750049, 0.007995605468749965, 0.054199218750000076, 0.11416625976562504, 0.171844482421875, 0.22454833984374997, 0.28076171875000006, 0.3431091308593751, 0.399993896484375, 0.4374694824218749, 0.45455932617187506, 0.4599609375000001, 0.455963134765625, 0.4346923828125, 0.393768310546875, 0.34939575195312506, 0.3250122070312499, 0.3274230957031249, 0.34042358398437494, 0.3446960449218753, 0.33819580078125, 0.3333435058593749, 0.33740234375, 0.3435363769531251, 0.34228515625, 0.3357849121093749, 0.334930419921875, 0.343353271484375, 0.3490905761718749, 0.33444213867187506, 0.29278564453125, 0.2334899902343751, 0.17135620117187494, 0.11419677734375017, 0.06182861328125028, 0.016815185546875222, -0.007904052734375, 0.004119873046874889, 0.05596923828125017, 0.12823486328125006, 0.19073486328125, 0.225128173828125, 0.2359619140625001, 0.23818969726562497, 0.23666381835937483, 0.22116088867187506, 0.1810607910156251, 0.12023925781249989, 0.05581665039062483, 0.0064697265625000555, -0.014099121093749889, 0.0026855468750002776, 0.056304931640624944, 0.12908935546874994, 0.19061279296874994, 0.22070312500000006, 0.22897338867187494, 0.2448425292968749, 0.2837829589843749, 0.3291320800781249, 0.3535156249999999, 0.35656738281249994, 0.37387084960937506, 0.4429931640625, 0.5623779296874999, 0.687408447265625, 0.7657775878906251, 0.7764587402343752, 0.73834228515625, 0.68963623046875, 0.661651611328125, 0.66400146484375, 0.683837890625, 0.6965332031249999, 0.6863403320312499, 0.6640625, 0.6609191894531248, 0.6962280273437498, 0.7496337890625, 0.7741699218749999, 0.74462890625, 0.6879577636718749, 0.656829833984375, 0.671295166015625, 0.6953430175781251, 0.6788024902343748, 0.61895751953125, 0.5706176757812499, 0.5905761718750001, 0.67596435546875, 0.765106201171875, 0.800750732421875, 0.7877197265625, 0.7833251953124998, 0.832183837890625, 0.9178161621093749, 0.9827575683593751, 0.9903564453125, 0.9566650390625001, 0.9208068847656251, 0.8981628417968751, 0.87451171875, 0.84033203125, 0.8092651367187499, 0.7926635742187503, 0.769134521484375, 0.6996765136718752, 0.57598876953125, 0.438568115234375, 0.3367919921875, 0.278472900390625, 0.23168945312499992, 0.17285156250000006, 0.1181030273437499, 0.09872436523437496, 0.11572265624999994, 0.13217163085937506, 0.11218261718749992, 0.05838012695312504, 0.006042480468749931, -0.015075683593749944, -0.006835937499999993, 0.006774902343750017, 0.007507324218749913, -0.0019836425781250477, -0.007019042968750007},
-    {-0.0048217773437499965, 0.006713867187499948, 0.013793945312499993, -0.006408691406249993, -0.05752563476562491, -0.11145019531250004, -0.132354736328125, -0.11621093749999997, -0.09869384765624994, -0.11758422851562503, -0.17248535156250008, -0.2317199707031249, -0.27862548828125006, -0.3366394042968751, -0.438262939453125, -0.575775146484375, -0.699615478515625, -0.76910400390625, -0.7925415039062501, -0.8090820312499999, -0.8402099609375, -0.8744201660156252, -0.898040771484375, -0.9206848144531249, -0.95654296875, -0.9902343749999999, -0.982635498046875, -0.9176940917968749, -0.832061767578125, -0.783203125, -0.7875976562500001, -0.800628662109375, -0.7650146484375, -0.6758422851562499, -0.5904541015625002, -0.57049560546875, -0.61883544921875, -0.678680419921875, -0.695220947265625, -0.6711730957031249, -0.656707763671875, -0.687835693359375, -0.7445068359375002, -0.7740478515625, -0.7495117187500001, -0.69610595703125, -0.6607971191406248, -0.6639404296875, -0.6862182617187501, -0.6964111328124999, -0.6837158203125, -0.66387939453125, -0.6615295410156251, -0.6895141601562502, -0.73822021484375, -0.776336669921875, -0.76568603515625, -0.687286376953125, -0.562286376953125, -0.4428710937499999, -0.3737792968749999, -0.3564453124999999, -0.3533935546874999, -0.32901000976562494, -0.28366088867187506, -0.24472045898437503, -0.22885131835937486, -0.22058105468750006, -0.1904907226562501, -0.12896728515625017, -0.056182861328125, -0.0025634765624999445, 0.01422119140625, -0.00634765625, -0.055694580078125, -0.12011718749999989, -0.1809387207031249, -0.22103881835937497, -0.23654174804687472, -0.23806762695312494, -0.23583984375, -0.2250366210937499, -0.19061279296874978, -0.1280517578124999, -0.05572509765625017, -0.0039062500000001665, 0.008026123046874889, -0.016784667968749833, -0.06182861328125017, -0.11413574218749997, -0.1712341308593751, -0.23333740234375, -0.29266357421875006, -0.334320068359375, -0.348968505859375, -0.34323120117187494, -0.33477783203125, -0.3356628417968751, -0.3421630859374999, -0.34341430664062517, -0.3372497558593751, -0.33322143554687533, -0.3380737304687501, -0.344573974609375, -0.34030151367187506, -0.3273010253906251, -0.3248901367187501, -0.349273681640625, -0.3936462402343752, -0.4345703125, -0.4558410644531249, -0.4598388671875, -0.4544677734375001, -0.4373779296875, -0.39987182617187494, -0.342987060546875, -0.28063964843750006, -0.22445678710937506, -0.17175292968749994, -0.11398315429687497, -0.05392456054687493, -0.007751464843749903, 0.011016845703125028, 0.006011962890625021, -0.0053710937499999965, -0.007812499999999934, 9.155273437499371e-05, 0.007965087890624993, 0.00540161132812499, -0.006011962890624962, -0.010925292968750049, 0.007995605468749965, 0.054199218750000076, 0.11416625976562504, 0.171844482421875, 0.22454833984374997, 0.28076171875000006, 0.3431091308593751, 0.399993896484375, 0.4374694824218749, 0.45455932617187506, 0.4599609375000001, 0.455963134765625, 0.4346923828125, 0.393768310546875, 0.34939575195312506, 0.3250122070312499, 0.3274230957031249, 0.34042358398437494, 0.3446960449218753, 0.33819580078125, 0.3333435058593749, 0.33740234375, 0.3435363769531251, 0.34228515625, 0.3357849121093749, 0.334930419921875, 0.343353271484375, 0.3490905761718749, 0.33444213867187506, 0.29278564453125, 0.2334899902343751, 0.17135620117187494, 0.11419677734375017, 0.06182861328125028, 0.016815185546875222, -0.007904052734375, 0.004119873046874889, 0.05596923828125017, 0.12823486328125006, 0.19073486328125, 0.225128173828125, 0.2359619140625001, 0.23818969726562497, 0.23666381835937483, 0.22116088867187506, 0.1810607910156251, 0.12023925781249989, 0.05581665039062483, 0.0064697265625000555, -0.014099121093749889, 0.0026855468750002776, 0.056304931640624944, 0.12908935546874994, 0.19061279296874994, 0.22070312500000006, 0.22897338867187494, 0.2448425292968749, 0.2837829589843749, 0.3291320800781249, 0.3535156249999999, 0.35656738281249994, 0.37387084960937506, 0.4429931640625, 0.5623779296874999, 0.687408447265625, 0.7657775878906251, 0.7764587402343752, 0.73834228515625, 0.68963623046875, 0.661651611328125, 0.66400146484375, 0.683837890625, 0.6965332031249999, 0.6863403320312499, 0.6640625, 0.6609191894531248, 0.6962280273437498, 0.7496337890625, 0.7741699218749999, 0.74462890625, 0.6879577636718749, 0.656829833984375, 0.671295166015625, 0.6953430175781251, 0.6788024902343748, 0.61895751953125, 0.5706176757812499, 0.5905761718750001, 0.67596435546875, 0.765106201171875, 0.800750732421875, 0.7877197265625, 0.7833251953124998, 0.832183837890625, 0.9178161621093749, 0.9827575683593751, 0.9903564453125, 0.9566650390625001, 0.9208068847656251, 0.8981628417968751, 0.87451171875, 0.84033203125, 0.8092651367187499, 0.7926635742187503, 0.769134521484375, 0.6996765136718752, 0.57598876953125, 0.438568115234375, 0.3367919921875, 0.278472900390625, 0.23168945312499992, 0.17285156250000006, 0.1181030273437499, 0.09872436523437496, 0.11572265624999994, 0.13217163085937506, 0.11218261718749992, 0.05838012695312504, 0.006042480468749931, -0.015075683593749944, -0.006835937499999993, 0.006774902343750017, 0.007507324218749913, -0.0019836425781250477, -0.007019042968750007},
-    {-0.0048217773437499965, 0.006713867187499948, 0.013793945312499993, -0.006408691406249993, -0.05752563476562491, -0.11145019531250004, -0.132354736328125, -0.11621093749999997, -0.09869384765624994, -0.11758422851562503, -0.17248535156250008, -0.2317199707031249, -0.27862548828125006, -0.3366394042968751, -0.438262939453125, -0.575775146484375, -0.699615478515625, -0.76910400390625, -0.7925415039062501, -0.8090820312499999, -0.8402099609375, -0.8744201660156252, -0.898040771484375, -0.9206848144531249, -0.95654296875, -0.9902343749999999, -0.982635498046875, -0.9176940917968749, -0.832061767578125, -0.783203125, -0.7875976562500001, -0.800628662109375, -0.7650146484375, -0.6758422851562499, -0.5904541015625002, -0.57049560546875, -0.61883544921875, -0.678680419921875, -0.695220947265625, -0.6711730957031249, -0.656707763671875, -0.687835693359375, -0.7445068359375002, -0.7740478515625, -0.7495117187500001, -0.69610595703125, -0.6607971191406248, -0.6639404296875, -0.6862182617187501, -0.6964111328124999, -0.6837158203125, -0.66387939453125, -0.6615295410156251, -0.6895141601562502, -0.73822021484375, -0.776336669921875, -0.76568603515625, -0.687286376953125, -0.562286376953125, -0.4428710937499999, -0.3737792968749999, -0.3564453124999999, -0.3533935546874999, -0.32901000976562494, -0.28366088867187506, -0.24472045898437503, -0.22885131835937486, -0.22058105468750006, -0.1904907226562501, -0.12896728515625017, -0.056182861328125, -0.0025634765624999445, 0.01422119140625, -0.00634765625, -0.055694580078125, -0.12011718749999989, -0.1809387207031249, -0.22103881835937497, -0.23654174804687472, -0.23806762695312494, -0.23583984375, -0.2250366210937499, -0.19061279296874978, -0.1280517578124999, -0.05572509765625017, -0.0039062500000001665, 0.008026123046874889, -0.016784667968749833, -0.06182861328125017, -0.11413574218749997, -0.1712341308593751, -0.23333740234375, -0.29266357421875006, -0.334320068359375, -0.348968505859375, -0.34323120117187494, -0.33477783203125, -0.3356628417968751, -0.3421630859374999, -0.34341430664062517, -0.3372497558593751, -0.33322143554687533, -0.3380737304687501, -0.344573974609375, -0.34030151367187506, -0.3273010253906251, -0.3248901367187501, -0.349273681640625, -0.3936462402343752, -0.4345703125, -0.4558410644531249, -0.4598388671875, -0.4544677734375001, -0.4373779296875, -0.39987182617187494, -0.342987060546875, -0.28063964843750006, -0.22445678710937506, -0.17175292968749994, -0.11398315429687497, -0.05392456054687493, -0.007751464843749903, 0.011016845703125028, 0.006011962890625021, -0.0053710937499999965, -0.007812499999999934, 9.155273437499371e-05, 0.007965087890624993, 0.00540161132812499, -0.006011962890624962, -0.010925292968750049, 0.007995605468749965, 0.054199218750000076, 0.11416625976562504, 0.171844482421875, 0.22454833984374997, 0.28076171875000006, 0.3431091308593751, 0.399993896484375, 0.4374694824218749, 0.45455932617187506, 0.4599609375000001, 0.455963134765625, 0.4346923828125, 0.393768310546875, 0.34939575195312506, 0.3250122070312499, 0.3274230957031249, 0.34042358398437494, 0.3446960449218753, 0.33819580078125, 0.3333435058593749, 0.33740234375, 0.3435363769531251, 0.34228515625, 0.3357849121093749, 0.334930419921875, 0.343353271484375, 0.3490905761718749, 0.33444213867187506, 0.29278564453125, 0.2334899902343751, 0.17135620117187494, 0.11419677734375017, 0.06182861328125028, 0.016815185546875222, -0.007904052734375, 0.004119873046874889, 0.05596923828125017, 0.12823486328125006, 0.19073486328125, 0.225128173828125, 0.2359619140625001, 0.23818969726562497, 0.23666381835937483, 0.22116088867187506, 0.1810607910156251, 0.12023925781249989, 0.05581665039062483, 0.0064697265625000555, -0.014099121093749889, 0.0026855468750002776, 0.056304931640624944, 0.12908935546874994, 0.19061279296874994, 0.22070312500000006, 0.22897338867187494, 0.2448425292968749, 0.2837829589843749, 0.3291320800781249, 0.3535156249999999, 0.35656738281249994, 0.37387084960937506, 0.4429931640625, 0.5623779296874999, 0.687408447265625, 0.7657775878906251, 0.7764587402343752, 0.73834228515625, 0.68963623046875, 0.661651611328125, 0.66400146484375, 0.683837890625, 0.6965332031249999, 0.6863403320312499, 0.6640625, 0.6609191894531248, 0.6962280273437498, 0.7496337890625, 0.7741699218749999, 0.74462890625, 0.6879577636718749, 0.656829833984375, 0.671295166015625, 0.6953430175781251, 0.6788024902343748, 0.61895751953125, 0.5706176757812499, 0.5905761718750001, 0.67596435546875, 0.765106201171875, 0.800750732421875, 0.7877197265625, 0.7833251953124998, 0.832183837890625, 0.9178161621093749, 0.9827575683593751, 0.9903564453125, 0.9566650390625001, 0.9208068847656251, 0.8981628417968751, 0.87451171875, 0.84033203125, 0.8092651367187499, 0.7926635742187503, 0.769134521484375, 0.6996765136718752, 0.57598876953125, 0.438568115234375, 0.3367919921875, 0.278472900390625, 0.23168945312499992, 0.17285156250000006, 0.1181030273437499, 0.09872436523437496, 0.11572265624999994, 0.13217163085937506, 0.11218261718749992, 0.05838012695312504, 0.006042480468749931, -0.015075683593749944, -0.006835937499999993, 0.006774902343750017, 0.007507324218749913, -0.0019836425781250477, -0.007019042968750007},
-    {-0.004576628480178145, 0.006650084531867273, 0.01370989731810901, -0.006268812957977002, -0.057625960345393336, -0.11143801748349261, -0.13229378624685262, -0.11628873868535988, -0.09865373688753565, -0.1175683036526181, -0.17253388010951654, -0.23168129895830397, -0.2786250270436465, -0.33667624162799487, -0.4382188096939652, -0.5757946686367396, -0.6996322259716676, -0.7690660754562353, -0.7925717859059211, -0.8090804135310511, -0.8401837856943145, -0.8744540775581374, -0.898022275802846, -0.9206784796071167, -0.956564360984118, -0.9902179822822101, -0.982632198450405, -0.9177159321294774, -0.8320364128344875, -0.7832152063601068, -0.7876047090360113, -0.8006114216804961, -0.7650256136527305, -0.6758490674650932, -0.5904313802866488, -0.5705209316347004, -0.6188223825112291, -0.678675394450261, -0.6952373525300941, -0.6711589896733339, -0.6567089556066656, -0.6878479856998392, -0.7444897433209823, -0.7740590828258406, -0.7495111182201679, -0.6960996947982881, -0.6608019686259502, -0.6639427390703433, -0.6862099581750639, -0.6964188649252454, -0.6837147397224945, -0.6638736351023304, -0.6615358237167632, -0.6895155338184717, -0.7382074131743461, -0.7763572003077664, -0.7656664676859661, -0.6872974361484037, -0.562285015529693, -0.44286839756294455, -0.3737780671367321, -0.35645476158118317, -0.35337844093493187, -0.32902327184564983, -0.2836565852022143, -0.24471398399247754, -0.2288641199980746, -0.22056932564179885, -0.1904960007125699, -0.1289688094984866, -0.05617837498506423, -0.002566509314698262, 0.0142212073354549, -0.006346652587176316, -0.05569330616798018, -0.12012214201737265, -0.180932092073452, -0.22104303317236274, -0.23654303206306504, -0.23806120342472475, -0.2358476440264587, -0.22503215442079888, -0.1906113132447556, -0.1280582129886768, -0.055717251607220075, -0.003911818926817245, 0.008027868308629726, -0.016783613584191392, -0.061830190229822446, -0.11413531996288123, -0.1712333028482269, -0.2333384026566932, -0.2926634772074446, -0.33431902179107276, -0.3489702525990238, -0.34322904140011357, -0.3347809154877901, -0.3356577456487455, -0.3421709207598937, -0.3434042217300159, -0.3372604087871313, -0.33321211791244654, -0.33808079782543954, -0.3445685762648281, -0.3403067191296016, -0.3272948957438767, -0.3248970088735775, -0.34926745170487195, -0.39365028959878495, -0.43456894458539097, -0.45584071167147516, -0.4598391732079007, -0.45446885875880433, -0.43737541887856735, -0.39987457104265317, -0.3429855513586299, -0.2806392508660115, -0.2244585420983492, -0.17175108971398625, -0.11398408719020445, -0.05392448329774014, -0.007751776314794137, 0.011018784402610268, 0.006007642040626142, -0.005364808999166672, -0.007819326653563654, 9.721640470723605e-05, 0.00796174368227214, 0.005402534887729555, -0.00601138915143401, -0.010925930267165235, 0.007995112868793466, 0.054201141568239165, 0.11416373472889893, 0.17184602005220917, 0.2245492579128478, 0.2807579865349228, 0.3431144253621177, 0.3999894823058554, 0.4374706357680374, 0.4545623499038643, 0.45995491199537547, 0.4559695776521938, 0.4346878452660973, 0.39377046215831907, 0.3493942759675795, 0.3250156673989905, 0.32741608717778126, 0.34043321511882507, 0.3446868550901222, 0.3382013047134454, 0.33334291100692226, 0.33739963743162626, 0.3435391979387577, 0.3422845552513365, 0.33578356379597357, 0.3349311996054843, 0.34335551039851464, 0.3490854600594643, 0.33444675402154556, 0.29278612046051133, 0.23348205578819003, 0.17136940567832679, 0.11418434349892814, 0.061833931778864704, 0.016819577828925958, -0.007915318229825719, 0.004131713836511952, 0.055962289395358744, 0.1282358258959702, 0.19073637365580776, 0.22512912343010816, 0.23595629462353634, 0.2381975992003894, 0.23665871015465267, 0.22115970561978582, 0.1810669107652061, 0.12023395274502552, 0.05581511275587575, 0.006479591123145778, -0.014112452148349774, 0.002693996818975475, 0.056307495756414305, 0.12907634600381324, 0.19062904495273508, 0.22069275048145426, 0.22897290993341748, 0.2448515985644944, 0.28377279302086245, 0.3291361097143236, 0.35351985239344685, 0.35655860461015654, 0.37387829994295646, 0.4429902042909315, 0.5623780921457582, 0.6874067877840175, 0.7657830131432678, 0.7764522293669656, 0.7383438173152426, 0.6896439963034364, 0.6616365555623722, 0.6640155431167669, 0.6838339352761018, 0.6965240359186757, 0.6863562587934722, 0.6640519328763596, 0.6609149033936255, 0.696246833663327, 0.7496110872711257, 0.7741827089820836, 0.7446331970442266, 0.6879412523657641, 0.6568449664288346, 0.6712939477969897, 0.6953280688980081, 0.6788238569546807, 0.618944248419004, 0.5706144697087931, 0.5905917710734028, 0.675949743151927, 0.7651075667433269, 0.8007640451688693, 0.787702458946436, 0.783331973287734, 0.8321938064393446, 0.9177973762045322, 0.9827682094588999, 0.9903669423449883, 0.9566354353560385, 0.9208384241488616, 0.8981498132161548, 0.874498019269355, 0.840361189521222, 0.8092438884235743, 0.7926589308066201, 0.7691629056961078, 0.699646854293297, 0.5759928141194236, 0.4385999374892096, 0.3367409273000622, 0.27850948145909543, 0.23169378825777764, 0.17280887982021148, 0.11815069021527708, 0.0987138018650123, 0.1156775094548072, 0.13224860315593925, 0.11212955079955753, 0.05835887280337055, 0.006142334084222337, -0.015196307143734697, -0.006790808382332474, 0.006887051745941751, 0.007221961425001028, -0.0015924808213545344, -0.007394576612517323},
-    {0.006302197099763419, 0.008115977243512172, 0.0007933059324549269, -0.02123442676754376, -0.0558194545640234, -0.09217496250407302, -0.11726663188364467, -0.1254133013696081, -0.12361331033825224, -0.1279106607715173, -0.15328087086596032, -0.20501773127783693, -0.27827181842486454, -0.36496943239117174, -0.4605059527277344, -0.5631386516387912, -0.6669921625706237, -0.7574531525614998, -0.8169535757387836, -0.8390181261820162, -0.8381059269367084, -0.8432927566621826, -0.877055448436032, -0.9354103774764341, -0.9877152817371315, -0.9992864098120144, -0.9595901447558897, -0.8918460675933367, -0.8344880396825507, -0.8095126201296166, -0.8052581759708333, -0.7891873717970637, -0.7395219997354522, -0.6672003783187243, -0.6080513002882013, -0.5921935065224628, -0.6185982112861377, -0.6578456568992945, -0.6797411522683023, -0.6793894272487473, -0.6774183280784221, -0.6952668057788303, -0.7305492590982942, -0.757173771999493, -0.7503877181086474, -0.7120894788117722, -0.6709968990153805, -0.6566851004965739, -0.6724238280145419, -0.6935688508396428, -0.6936150056477812, -0.672539144968268, -0.6587594132731631, -0.6809247960016835, -0.7354288000501599, -0.7813638941271418, -0.7702608440131302, -0.6857687884162433, -0.5584971528254343, -0.44293484228950053, -0.37666276585559594, -0.35657735473264157, -0.35011999364647556, -0.3279989472857399, -0.287661528563792, -0.2482936814426882, -0.22584192102880216, -0.2140606345132466, -0.18973178641008925, -0.13616579082132885, -0.06215283827297813, 0.0013440593611361296, 0.023619237843421237, -0.003900872532398403, -0.06395745077214687, -0.12860573983378387, -0.17848064892968235, -0.21061341517529145, -0.2314865738322789, -0.24479363045254085, -0.24574557124664004, -0.22572041915459162, -0.18149444220463584, -0.12056471033222027, -0.058848825338751964, -0.013535320632767245, 0.003587999408344422, -0.010923530960570527, -0.05282814652609763, -0.11271902528953032, -0.17905414039213258, -0.24106321643979506, -0.29098983197819894, -0.3250831432905599, -0.3432808257111869, -0.3482705397851154, -0.3446436401470032, -0.3380579713161612, -0.33377803189284055, -0.3345921911915411, -0.33937019035930255, -0.3438236036507793, -0.3435859317023324, -0.33769030925126775, -0.3299130905194665, -0.32699517269408834, -0.33504579737090356, -0.35642190422052616, -0.3884896800226633, -0.4242195043794547, -0.45401738127296165, -0.46849512745800065, -0.46178399381137253, -0.43401199768410115, -0.39096732853521105, -0.3403563020327494, -0.28698563924270365, -0.23087379986160922, -0.17033108346805265, -0.10748528776863345, -0.05078713148666354, -0.011125184853172806, 0.005945714864790189, 0.00509637562474706, -0.0016886655676962292, -0.003935697919362706, 7.57055075837013e-05, 0.004058032103571835, 0.0017552779794845798, -0.005048781145196905, -0.005848241345248764, 0.011309162890101511, 0.051026003794142155, 0.10770548867774075, 0.1704796587138641, 0.2309585107764573, 0.28705832491522254, 0.3404604927135675, 0.39110228080750464, 0.43414419397376347, 0.4618883038155312, 0.4685811731552575, 0.4541164111555578, 0.42434951968108237, 0.3886370882029854, 0.35655758888657724, 0.33515627654486174, 0.3270951421004562, 0.33002751797524305, 0.3378271670098783, 0.3437292735761306, 0.3439531382389004, 0.33948444265520566, 0.3347093055360995, 0.3339137961738538, 0.3382062958778854, 0.3447822510918745, 0.34838652844859097, 0.34338751738966605, 0.3252073852299627, 0.2911403990814766, 0.24121353029179204, 0.1791610463876166, 0.11276379064043385, 0.0528414659368614, 0.010968456060544196, -0.0034631419350942827, 0.01373664502071792, 0.05907565687881444, 0.12075895464350589, 0.18163181116109428, 0.22581942938352928, 0.24584269952556032, 0.24491101171816715, 0.23161996956872527, 0.21074536132160887, 0.1786009370810412, 0.12871910495940042, 0.06407476796902861, 0.00402647159921915, -0.023490687328489024, -0.0012200267918734409, 0.06227102650940469, 0.13628324803490777, 0.18985351280721047, 0.21418623441781298, 0.2259670074378355, 0.24841533783381442, 0.28778114233346647, 0.32811949462984563, 0.3502414178756325, 0.35669559128732525, 0.376773596734273, 0.4430384055712168, 0.5585984177080744, 0.6858737296358646, 0.7703722934488916, 0.7814807731327137, 0.7355485564391755, 0.6810459080524939, 0.6588816420581438, 0.672662219294633, 0.6937379485077512, 0.69369079789085, 0.6725450410970293, 0.6568066640262183, 0.6711193840204013, 0.7122122558082402, 0.7505098060513933, 0.757295146496226, 0.7306709137293309, 0.6953894201717195, 0.6775412428813457, 0.6795113868298917, 0.6798620654415147, 0.6579670837249046, 0.618721502135426, 0.592317393277568, 0.608171954842909, 0.6673147177636662, 0.7396313705243083, 0.7892976566383823, 0.8053754520040185, 0.8096379730477967, 0.834616436171115, 0.8919706671511908, 0.9597082859161241, 0.9994017467669654, 0.9878340310672915, 0.9355351448187261, 0.8771824275732814, 0.8434150243907936, 0.8382199548577574, 0.8391276482690517, 0.8170672443040978, 0.7575778502467174, 0.6671275967773975, 0.5632777515285763, 0.46064066939151205, 0.3650969947299672, 0.2783960855971916, 0.20514437717318657, 0.1534104906323936, 0.12803612340814358, 0.12372461395489392, 0.12550672455948925, 0.11735011679654755, 0.09226296756970584, 0.055918229992505356, 0.021327620216339063, -0.0007459990934718247, -0.008161519163958714, -0.0064659268387224356, -0.0027487586801505162, -0.00015160681220854034, 0.0024848636867455115},
-    {-0.00968508752378238, -0.01689242500681453, -0.026201192767321003, -0.03733372128856295, -0.04975819222134244, -0.06311011792313741, -0.0776380071105886, -0.09451148859695058, -0.11585796227056652, -0.144466843645772, -0.18319865606559405, -0.23423107844619281, -0.29833675541606575, -0.3743976383906852, -0.4593118742913059, -0.5483527183388308, -0.6359198979975854, -0.7165151489761812, -0.7857065281936148, -0.8408412165367876, -0.8813276188864869, -0.9084198945336516, -0.9245718926503854, -0.9325460536727008, -0.9345324769013175, -0.9315330114362983, -0.9231928305661283, -0.9081355765073721, -0.8847116251172618, -0.851942929583066, -0.8103785702928874, -0.7625843402085087, -0.7130781461598513, -0.6676694562510881, -0.6323273707163022, -0.6118430790508218, -0.6086285662129309, -0.6219807083559699, -0.648037782666838, -0.6804874104329794, -0.7118930809445194, -0.735340528276397, -0.746009994984556, -0.7422832413088558, -0.7260975430154465, -0.7024391473418561, -0.6780813916001218, -0.659864119538156, -0.6529316906865118, -0.6593645778061977, -0.6775480002460211, -0.7024418743120199, -0.7266939113722541, -0.742327857642263, -0.7425948604810898, -0.7235346221936694, -0.6848653077744457, -0.6299891911148645, -0.5651224316397815, -0.49777617259463214, -0.43497693511428054, -0.38167636361888907, -0.33974817183303063, -0.30781711848066257, -0.28195008234756513, -0.25701750740733914, -0.2283610468913777, -0.19332393205439535, -0.15223453869282016, -0.10857225723234754, -0.06825311915284366, -0.03819823562131347, -0.024534279642710488, -0.03087530228688301, -0.05712401970925973, -0.09911092878381711, -0.1491906128928664, -0.19768510049165927, -0.23485996847690377, -0.2529892204703921, -0.24804043866897846, -0.22059722379533936, -0.17580998591683072, -0.12238650571274012, -0.07084802990404393, -0.031435353544684186, -0.01211717706578036, -0.01711717632842369, -0.04624851216420772, -0.09515770150513664, -0.15637901324104686, -0.22093216188814835, -0.28009658262342996, -0.3269835916422566, -0.35760050162152013, -0.37123597020404164, -0.37015808236119224, -0.3587665575606375, -0.34244437751313167, -0.3263917639663567, -0.31469384987954085, -0.30978648459645236, -0.31236858528606126, -0.32169548606209236, -0.336103982706657, -0.3535845190609935, -0.372233739252047, -0.3904819634399902, -0.4070748579706317, -0.42087161263570894, -0.43058014219711854, -0.4345678671614627, -0.43086069068209815, -0.4173811699152553, -0.3923974432381557, -0.3550797377181584, -0.3060124460659091, -0.24750120650224883, -0.18355001432620752, -0.11945552601096654, -0.06105719415970674, -0.01377020742094711, 0.018408810176916687, 0.03371221508182277, 0.033044008201084565, 0.01994166029883885, 4.295882597898587e-05, -0.019851376969906343, -0.032941619795500386, -0.03359272094835484, -0.018271042889045096, 0.013923393141357529, 0.06121966777350592, 0.11961936422785295, 0.1837073470726152, 0.2476459730037246, 0.3061416438977461, 0.3551938865391202, 0.3925001893877358, 0.41747817443447854, 0.4309581160539123, 0.43467086419745893, 0.4306917185671732, 0.42099214714264205, 0.40720234355609336, 0.39061286650799226, 0.37236420496998435, 0.35371157223949523, 0.33622639034033197, 0.3218140532123511, 0.3124858198401573, 0.309905743034226, 0.3148182178324364, 0.3265229949232988, 0.34258219352575553, 0.35890851438316373, 0.37030004690625024, 0.37137309270542157, 0.357728432554492, 0.3270996285231932, 0.2802004499619031, 0.22102622228702157, 0.1564678526288376, 0.09524718816267685, 0.046344557213586546, 0.017224491113475626, 0.012238315438261038, 0.03157024935659264, 0.07099411452815674, 0.12253935069358424, 0.17596429720322643, 0.2207479443426491, 0.2481837093271867, 0.2531230020496981, 0.23498422293741988, 0.1978015394217478, 0.14930211842806285, 0.09922081347714673, 0.05723530647111663, 0.030990175345843585, 0.024653795763716235, 0.038322311311969115, 0.0683807445473058, 0.10870184596879123, 0.1523643120016661, 0.19345225174509734, 0.22848664599772472, 0.2571396056384718, 0.2820684040637264, 0.3079318462848129, 0.33985986807714363, 0.3817858800208032, 0.43508531545286955, 0.49788454321310266, 0.5652318741815976, 0.6301006015648103, 0.6849792607391976, 0.7236512718945999, 0.7427139128482678, 0.7424486371512744, 0.726815522979308, 0.7025634313869722, 0.67766886353181, 0.6594845380493507, 0.6530510351766932, 0.6599835507708853, 0.6782018081525629, 0.7025613409216738, 0.7262218975951282, 0.7424095287518013, 0.7461373414148782, 0.7354675800644154, 0.7120183402983049, 0.6806096552533935, 0.6481564510227813, 0.6220961271693486, 0.608741939742024, 0.61195621774218, 0.6324422176649518, 0.6677875345915896, 0.7132000853304742, 0.7627096291332351, 0.8105056304090682, 0.8520695131033537, 0.8848354474412057, 0.9082550142785841, 0.9233074830272234, 0.9316439460179815, 0.934642058170615, 0.9326573693375397, 0.9246879106501263, 0.9085425766143365, 0.8814572493874699, 0.8409761657683363, 0.7858435628475366, 0.7166502523095836, 0.6360494090664085, 0.5484744855793373, 0.45942607995694645, 0.37450700443643836, 0.29844598187760213, 0.23434556155383776, 0.18332273714197295, 0.1446019974237405, 0.11600139907486956, 0.0946555941511823, 0.07777088043651612, 0.06321722497079352, 0.049824885820367384, 0.03734815126126775, 0.026157001373789138, 0.016790628532264103, 0.009534689600291284, 0.004160930227667038, -9.713456928986736e-05, -0.0043437928330387655},
-    {0.016287894969638565, 0.02060324645413577, 0.02046881007555, 0.014676465271992234, 0.0022412456344953063, -0.017559035178742702, -0.04515409073304963, -0.08066256372169181, -0.12388527717333286, -0.1743106506378793, -0.2311321407172671, -0.29327710777256905, -0.35944606854206645, -0.42816088447073675, -0.49782007397278544, -0.5667591386600677, -0.6333135720068621, -0.695882084797806, -0.7529875428296494, -0.8033331730142206, -0.8458517546751316, -0.8797457697279867, -0.904516830664116, -0.919983126818922, -0.9262841115328522, -0.9238721764996203, -0.9134916033057975, -0.8961456227073827, -0.8730529257253031, -0.8455954337840564, -0.8152595260535662, -0.7835732217528516, -0.7520420080064802, -0.7220860790624787, -0.6949817046971603, -0.6718092745641997, -0.6534102770749828, -0.6403550778428636, -0.6329228808079652, -0.6310947064900193, -0.6345596316125233, -0.6427339302399149, -0.6547921672825299, -0.6697087491057437, -0.6863079595818026, -0.7033201266174969, -0.7194412929349012, -0.7333936191942503, -0.7439837347557574, -0.750156372183701, -0.7510408699893243, -0.7459884916268622, -0.734598969096402, -0.7167352134488902, -0.6925257150879424, -0.662354754746622, -0.6268411313076834, -0.5868066559240922, -0.5432361361758622, -0.49723095597468464, -0.44995862822742616, -0.402600845387951, -0.35630257195120046, -0.31212461342861486, -0.2710018658206975, -0.23370911172807807, -0.20083580311810628, -0.1727707798651866, -0.14969734406270768, -0.1315985709426601, -0.1182722163203126, -0.10935410468291379, -0.10434847541677461, -0.10266344720029941, -0.10364954718831054, -0.1066391513865208, -0.1109846984868072, -0.11609366808681831, -0.12145854638256287, -0.12668032348580704, -0.1314844574053226, -0.13572867801993693, -0.13940246556339547, -0.14261849702192086, -0.14559678585698754, -0.1486426230154031, -0.15211974082381993, -0.15642035075377064, -0.1619338407119404, -0.16901595229956906, -0.1779601937113683, -0.18897308526261353, -0.20215459251289203, -0.21748479140445842, -0.2348174489100539, -0.25388081184971056, -0.27428549740590474, -0.29553899303627823, -0.31706592137531264, -0.33823292552080997, -0.35837679686002816, -0.37683431247179777, -0.39297217893427905, -0.4062154962227227, -0.41607325679596546, -0.4221595740241282, -0.4242095799219444, -0.42208923053362213, -0.4157985915792325, -0.40546852885447326, -0.3913510785128337, -0.3738041032810544, -0.3532711347339953, -0.3302575440505936, -0.3053043621829781, -0.2789611765841146, -0.2517595609156612, -0.2241884459054038, -0.19667271716905663, -0.16955613656767196, -0.1430894381231725, -0.11742416103673528, -0.0926124664074969, -0.06861285757232832, -0.04530140374447155, -0.02248776953696286, 6.490555201261718e-05, 0.0226174401632345, 0.0454306630111308, 0.06874146402762576, 0.09274022507627301, 0.11755093682046114, 0.14321516450556604, 0.16968081894949433, 0.19679643058116195, 0.22431132729495337, 0.25188179663145704, 0.2790829860691898, 0.30542597918560244, 0.3303791968645587, 0.35339302705934633, 0.37392639725058685, 0.391473881260832, 0.4055918837251846, 0.4159224747050306, 0.42221355308536185, 0.4243341958801604, 0.42228429287524744, 0.4161978601578158, 0.4063397570802556, 0.39309588194566714, 0.37695727370511917, 0.3584988813503944, 0.3383540611956602, 0.31718610817024684, 0.2956583063944454, 0.27440408579209874, 0.253998888381907, 0.2349352776791302, 0.21760266948021634, 0.2022728289870493, 0.18909197892850815, 0.17808001110496258, 0.1691369078157945, 0.16205608036389607, 0.15654394086991866, 0.1522446626003551, 0.14876877338621428, 0.14572398464734676, 0.14274649985324722, 0.13953098151485166, 0.13585739066558766, 0.13161304756503245, 0.12680849187795618, 0.12158603436096604, 0.11622027478561608, 0.1111102929765741, 0.10676367884220639, 0.10377302855493659, 0.10278597237798487, 0.10447019053027329, 0.10947519450848137, 0.11839288337233966, 0.13171901303731953, 0.14981773234735044, 0.17289123931262237, 0.2009563973288196, 0.23382983356867676, 0.27112263497410427, 0.31224528137303414, 0.3564229342624344, 0.4027206606214042, 0.45007764203316325, 0.49734892858122604, 0.5433528709911153, 0.5869220267813616, 0.6269551058558618, 0.6624674116571037, 0.6926372531218822, 0.7168459509769314, 0.7347093333541421, 0.7460989977758682, 0.7511520908788729, 0.750268900510623, 0.7440981400358724, 0.7335104025297094, 0.7195608429364377, 0.7034426799806753, 0.6864335696992045, 0.6698372657180073, 0.6549232295448231, 0.6428669747401238, 0.6346939158736618, 0.631229347386831, 0.6330569062011131, 0.6404874886633716, 0.6535401161561654, 0.6719356977915909, 0.695104049590863, 0.7222039257665112, 0.752155227861637, 0.7836820091761754, 0.8153644103179278, 0.8456972684416314, 0.8731528547839986, 0.8962450241673849, 0.9135920121999648, 0.923975191055748, 0.9263912873874813, 0.9200958652680146, 0.9046362676557389, 0.8798726726255564, 0.8459864337100667, 0.8034754137943128, 0.7531365652927714, 0.6960365326464206, 0.6334715349995365, 0.5669182082658366, 0.49797743092290725, 0.42831341478964857, 0.35959050282665206, 0.29341017693183813, 0.23125074018556258, 0.17441200431602294, 0.12396709209027149, 0.08072316667107052, 0.04519253891970512, 0.017575194172290448, -0.0022466616652563054, -0.014701894072830977, -0.020511883394029033, -0.020660872243936486, -0.016356376030204324, -0.008981176854830054, -3.8724717322236234e-05, 0.0089059935221673},
-    {-0.06590298908332579, -0.09875802706188244, -0.13148947897625846, -0.16405565020555807, -0.19641435511266872, -0.22852280508982, -0.26033750429886426, -0.2918141547245354, -0.3229075721896182, -0.3535716150092175, -0.38375912698404785, -0.41342189644655214, -0.4425106330752535, -0.47097496417854867, -0.49876345211574347, -0.5258236344671946, -0.5521020884839126, -0.5775445212371603, -0.6020958867481242, -0.6257005312048296, -0.6483023671668406, -0.6698450774173097, -0.6902723488466773, -0.7095281364435532, -0.7275569571275542, -0.744304212788475, -0.7597165414991647, -0.7737421954497392, -0.7863314437128366, -0.7974369974987492, -0.8070144551013634, -0.8150227632772808, -0.8214246913482506, -0.8261873138783227, -0.8292824973595448, -0.8306873859512143, -0.8303848809654168, -0.8283641084834492, -0.8246208692311221, -0.8191580646429075, -0.8119860929119505, -0.8031232087610323, -0.7925958406837891, -0.7804388595001657, -0.7666957922485401, -0.7514189757014487, -0.7346696441435037, -0.7165179464888225, -0.6970428883397408, -0.6763321951961254, -0.654482093711286, -0.6315970086510985, -0.6077891740409785, -0.5831781578730706, -0.5578903006845909, -0.5320580692977276, -0.5058193280209671, -0.4793165306394613, -0.4526958375556205, -0.42610616346753366, -0.3996981619787222, -0.3736231545045218, -0.3480320117644812, -0.3230739970130966, -0.29889558094989094, -0.2756392389517272, -0.2534422418735136, -0.23243545215718273, -0.21274213736320727, -0.19447681348534665, -0.1777441305206652, -0.1626378127374406, -0.14923966590942825, -0.13761866346379437, -0.1278301230214462, -0.11991498419391877, -0.11389919774372514, -0.10979323532039242, -0.1075917279593469, -0.10727324038430908, -0.10880018689654797, -0.11211889327850677, -0.11715980769875767, -0.1238378620951332, -0.13205298394957554, -0.1416907567691133, -0.15262322597059985, -0.1647098452511751, -0.17779855693097468, -0.19172699819862327, -0.20632382369262248, -0.22141013343162647, -0.23680099378186759, -0.25230703793795467, -0.2677361313100449, -0.28289508627087423, -0.29759140993364586, -0.31163506801796675, -0.3248402474256359, -0.3370270998988668, -0.34802344907605787, -0.3576664433978475, -0.3658041376499237, -0.37229698645761017, -0.37701923376689833, -0.3798601832513425, -0.38072533566574834, -0.37953738041534285, -0.3762370300104956, -0.37078368761746733, -0.363155939578715, -0.353351866543981, -0.34138916870634783, -0.32730510255507167, -0.3111562285178363, -0.2930179708469326, -0.2729839930842159, -0.25116539439584684, -0.22768973397727477, -0.20269989256958404, -0.17635278187883818, -0.14881791433001584, -0.12027584709738698, -0.09091651571601767, -0.06093747377853178, -0.030542056243170343, 6.251528845416e-05, 0.030667066332536526, 0.061062422905695767, 0.09104136489730569, 0.12040055979999931, 0.1489424573814161, 0.17647712630674303, 0.20282401435492572, 0.22781361470410608, 0.2512890217840573, 0.27310736139308944, 0.2931410811399726, 0.3112790887818629, 0.3274277276693246, 0.3415115802601476, 0.3534740925043751, 0.36327801381240266, 0.37090564927411507, 0.3763589227772712, 0.3796592516550651, 0.38084723545341687, 0.37998216332595, 0.3771413464172835, 0.3724192833626539, 0.36592666869459345, 0.3577892554874341, 0.34814658497140116, 0.33715059709542083, 0.32496413709888317, 0.3117593740569366, 0.29771614808316205, 0.2830202634016283, 0.2678617448337164, 0.2524330753823947, 0.23692743253884663, 0.22153694068688373, 0.20645095654496248, 0.1918544039716472, 0.17792617367775354, 0.16483760244881784, 0.15275104539830764, 0.14181855355998113, 0.13218066780317744, 0.12396533863484588, 0.11728697995489701, 0.11224566327573321, 0.10892645732166872, 0.10739891630862508, 0.1077167185880894, 0.10991745574060402, 0.1140225706411902, 0.12003744150945506, 0.1279516075170425, 0.13773913016973574, 0.14935908342467774, 0.16275616435713228, 0.17786141516660817, 0.19459304641789787, 0.2128573506557277, 0.23254969491750438, 0.2535555802003635, 0.2757517556178452, 0.2990073748075702, 0.32318518212203057, 0.3481427162460339, 0.37373351913081476, 0.3998083385091625, 0.42621631274954613, 0.452806127410317, 0.47942713355672795, 0.5059304186919129, 0.5321698220155581, 0.558002886647695, 0.5832917424263995, 0.6079039138935959, 0.631713049109076, 0.654599565965861, 0.6764512137072265, 0.6971635483545922, 0.7166403217343807, 0.7347937847299345, 0.7515449062717565, 0.7668235104068335, 0.7805683345478954, 0.7927270126896914, 0.8032559879864676, 0.8121203596089267, 0.819293669237344, 0.8247576328989384, 0.8285018241218904, 0.8305233145567478, 0.8308262783105819, 0.8294215662535157, 0.826326256495401, 0.8215631870976667, 0.8151604768875698, 0.8071510399858041, 0.7975720993506631, 0.7864647042901192, 0.7738732565048745, 0.7598450488083849, 0.7444298202317415, 0.7276793307696521, 0.7096469585658726, 0.6903873218791776, 0.6699559277207667, 0.6484088486167434, 0.6258024285302032, 0.6021930185811215, 0.5776367428324061, 0.5521892940703168, 0.5259057591991871, 0.4988404735955933, 0.4710469035265423, 0.44257755552996547, 0.4134839114831595, 0.3838163879445643, 0.3536243182445514, 0.32295595571943375, 0.2918584964269212, 0.2603781196477137, 0.22856004446352823, 0.1964486007031685, 0.16408731256177922, 0.13151899322074306, 0.09878584882344504, 0.06592959019226999, 0.03299155070187852, 1.280875059181154e-05, -0.0329656867064464},
-    {-0.04036062363062642, -0.06050119359704001, -0.08056953700141496, -0.10054178578751906, -0.12039424428394896, -0.14010343157985009, -0.1596461234277284, -0.17899939358124073, -0.19814065447717827, -0.217047697172401, -0.2356987304482326, -0.2540724189967832, -0.27214792060582615, -0.28990492226120945, -0.3073236750883252, -0.3243850280568901, -0.3410704603761966, -0.3573621125110663, -0.37324281575198115, -0.38869612027625944, -0.4037063216406854, -0.41825848564968404, -0.4323384715469387, -0.44593295348228534, -0.4590294402097555, -0.47161629297678653, -0.48368274156885394, -0.4952188984780958, -0.506215771168893, -0.5166652724178147, -0.5265602287098387, -0.5358943866773014, -0.5446624175725944, -0.5528599197702113, -0.5604834192983474, -0.5675303684048324, -0.573999142166763, -0.5798890331577371, -0.5852002441911083, -0.5899338791621428, -0.59409193201636, -0.5976772738756776, -0.600693638358236, -0.6031456051319452, -0.6050385817458628, -0.6063787837874719, -0.6071732134177665, -0.6074296363397658, -0.6071565572596551, -0.6063631939031785, -0.605059449653196, -0.6032558848774219, -0.6009636870183257, -0.598194639519939, -0.5949610896689098, -0.591275915429551, -0.5871524913548408, -0.5826046536573409, -0.577646664525815, -0.5722931757749266, -0.5665591919167859, -0.560460032744294, -0.5540112955171874, -0.5472288168424262, -0.5401286343410904, -0.5327269481942366, -0.5250400826602502, -0.5170844476560672, -0.508876500494279, -0.5004327078675284, -0.4917695081708011, -0.48290327425117885, -0.4738502766733786, -0.46462664758794203, -0.45524834528727315, -0.44573111953285216, -0.43609047773488274, -0.4263416520633666, -0.41649956756714407, -0.4065788113748056, -0.39659360304856484, -0.38655776615920445, -0.37648470114705856, -0.3663873595307014, -0.35627821952156524, -0.3461692630991273, -0.3360719545975963, -0.3259972208511948, -0.3159554329411944, -0.3059563895838124, -0.2960093021939496, -0.2861227816555277, -0.2763048268248994, -0.26656281478945987, -0.25690349289918357, -0.24733297258438125, -0.2378567249685015, -0.22847957828032067, -0.21920571706537578, -0.2100386831920055, -0.20098137864290172, -0.1920360700786216, -0.18320439515510817, -0.17448737057290398, -0.16588540183144282, -0.15739829465756885, -0.14902526807327848, -0.14076496906361302, -0.1326154888016664, -0.12457438038380725, -0.11663867802447989, -0.1088049176563273, -0.10106915887790721, -0.09342700818793137, -0.08587364344177773, -0.07840383946300222, -0.07101199473971939, -0.06369215913303994, -0.056438062522250636, -0.049243144309108575, -0.04210058370149626, -0.035003330694762386, -0.027944137667345395, -0.02091559150576306, -0.013910146172742131, -0.006920155631168393, 6.209296434143974e-05, 0.007044345897105259, 0.014034349428578764, 0.02103981633861883, 0.028068392555327042, 0.03512762396377499, 0.04222492348246887, 0.0493675384957514, 0.05656251872945914, 0.06381668465605922, 0.07113659651418187, 0.0785285240259471, 0.0859984168937604, 0.09355187615632705, 0.10119412648151063, 0.10892998947134677, 0.11676385805202079, 0.1246996720189361, 0.1327408948041426, 0.14089049153037306, 0.14915090841274867, 0.15752405356588361, 0.16601127927063603, 0.17461336575114017, 0.18333050650901075, 0.1921622952577544, 0.20110771449645165, 0.21016512575771107, 0.21933226156073793, 0.22860621909612916, 0.23798345566470241, 0.24745978588830847, 0.2570303807061648, 0.2666897681658104, 0.2764318360133028, 0.28624983608280247, 0.2961363904811923, 0.3060834995588996, 0.31608255165362636, 0.32612433458925066, 0.3361990489077689, 0.34629632280779976, 0.35640522875888325, 0.3665143017565935, 0.37661155917934735, 0.3866845222037489, 0.3967202387313673, 0.4067053077760137, 0.41662590525687104, 0.4264678111392486, 0.4362164378612907, 0.4458568599816667, 0.45537384498013084, 0.4647518851398542, 0.4739752304376237, 0.4830279223653636, 0.4918938286039821, 0.5005566784682853, 0.5090000990396261, 0.5172076519010885, 0.5251628703883394, 0.5328492972678254, 0.5402505227527411, 0.5473502227661718, 0.5541321973599918, 0.5605804091975108, 0.5666790220074934, 0.5724124389170132, 0.5777653405706935, 0.5827227229441667, 0.5872699347601145, 0.5913927144159825, 0.5950772263334259, 0.5983100966407159, 0.6010784481007304, 0.6033699341987514, 0.6051727723061009, 0.6064757758376638, 0.6072683853235538, 0.6075406983175847, 0.6072834980678039, 0.6064882808771151, 0.6051472820849744, 0.6032535006042531, 0.6008007219506465, 0.5977835397054327, 0.5941973753559701, 0.5900384964620267, 0.5853040330998797, 0.5799919925400812, 0.5741012721188536, 0.5676316702672433, 0.5605838956664211, 0.5529595745018498, 0.5447612557934456, 0.5359924147833216, 0.5266574543672129, 0.5167617045602277, 0.5063114199921486, 0.49531377543208505, 0.48377685934688636, 0.47170966550229376, 0.45912208262039383, 0.44602488211146346, 0.43242970390280305, 0.4183490403916025, 0.4037962185532751, 0.3887853802410084, 0.3733314607165225, 0.35745016545616476, 0.34115794528051735, 0.32447196985962085, 0.30741009964973076, 0.28999085632120003, 0.272233391740627, 0.25415745557379865, 0.23578336157919833, 0.21713195266492535, 0.19822456478477682, 0.17908298975197084, 0.15972943705153378, 0.14018649473472977, 0.12047708948106643, 0.1006244459153702, 0.0806520452691764, 0.06058358347721975, 0.040442928801142426, 0.020254079073646, 4.1118657209585074e-05, -0.020171824787834525},
+static const int16_t table [9][256 + 1] = {
+    {-158, 220, 452, -210, -1885, -3652, -4337, -3808, -3234, -3853, -5652, -7593, -9130, -11031, -14361, -18867, -22925, -25202, -25970, -26512, -27532, -28653, -29427, -30169, -31344, -32448, -32199, -30071, -27265, -25664, -25808, -26235, -25068, -22146, -19348, -18694, -20278, -22239, -22781, -21993, -21519, -22539, -24396, -25364, -24560, -22810, -21653, -21756, -22486, -22820, -22404, -21754, -21677, -22594, -24190, -25439, -25090, -22521, -18425, -14512, -12248, -11680, -11580, -10781, -9295, -8019, -7499, -7228, -6242, -4226, -1841, -84, 466, -208, -1825, -3936, -5929, -7243, -7751, -7801, -7728, -7374, -6246, -4196, -1826, -128, 263, -550, -2026, -3740, -5611, -7646, -9590, -10955, -11435, -11247, -10970, -10999, -11212, -11253, -11051, -10919, -11078, -11291, -11151, -10725, -10646, -11445, -12899, -14240, -14937, -15068, -14892, -14332, -13103, -11239, -9196, -7355, -5628, -3735, -1767, -254, 361, 197, -176, -256, 3, 261, 177, -197, -358, 262, 1776, 3741, 5631, 7358, 9200, 11243, 13107, 14335, 14895, 15072, 14941, 14244, 12903, 11449, 10650, 10729, 11155, 11295, 11082, 10923, 11056, 11257, 11216, 11003, 10975, 11251, 11439, 10959, 9594, 7651, 5615, 3742, 2026, 551, -259, 135, 1834, 4202, 6250, 7377, 7732, 7805, 7755, 7247, 5933, 3940, 1829, 212, -462, 88, 1845, 4230, 6246, 7232, 7503, 8023, 9299, 10785, 11584, 11684, 12251, 14516, 18428, 22525, 25093, 25443, 24194, 22598, 21681, 21758, 22408, 22824, 22490, 21760, 21657, 22814, 24564, 25368, 24400, 22543, 21523, 21997, 22785, 22243, 20282, 18698, 19352, 22150, 25071, 26239, 25812, 25668, 27269, 30075, 32203, 32452, 31348, 30173, 29431, 28656, 27536, 26518, 25974, 25203, 22927, 18874, 14371, 11036, 9125, 7592, 5664, 3870, 3235, 3792, 4331, 3676, 1913, 198, -494, -224, 222, 246, -65, -230, -158},
+    {-158, 220, 452, -210, -1885, -3652, -4337, -3808, -3234, -3853, -5652, -7593, -9130, -11031, -14361, -18867, -22925, -25202, -25970, -26512, -27532, -28653, -29427, -30169, -31344, -32448, -32199, -30071, -27265, -25664, -25808, -26235, -25068, -22146, -19348, -18694, -20278, -22239, -22781, -21993, -21519, -22539, -24396, -25364, -24560, -22810, -21653, -21756, -22486, -22820, -22404, -21754, -21677, -22594, -24190, -25439, -25090, -22521, -18425, -14512, -12248, -11680, -11580, -10781, -9295, -8019, -7499, -7228, -6242, -4226, -1841, -84, 466, -208, -1825, -3936, -5929, -7243, -7751, -7801, -7728, -7374, -6246, -4196, -1826, -128, 263, -550, -2026, -3740, -5611, -7646, -9590, -10955, -11435, -11247, -10970, -10999, -11212, -11253, -11051, -10919, -11078, -11291, -11151, -10725, -10646, -11445, -12899, -14240, -14937, -15068, -14892, -14332, -13103, -11239, -9196, -7355, -5628, -3735, -1767, -254, 361, 197, -176, -256, 3, 261, 177, -197, -358, 262, 1776, 3741, 5631, 7358, 9200, 11243, 13107, 14335, 14895, 15072, 14941, 14244, 12903, 11449, 10650, 10729, 11155, 11295, 11082, 10923, 11056, 11257, 11216, 11003, 10975, 11251, 11439, 10959, 9594, 7651, 5615, 3742, 2026, 551, -259, 135, 1834, 4202, 6250, 7377, 7732, 7805, 7755, 7247, 5933, 3940, 1829, 212, -462, 88, 1845, 4230, 6246, 7232, 7503, 8023, 9299, 10785, 11584, 11684, 12251, 14516, 18428, 22525, 25093, 25443, 24194, 22598, 21681, 21758, 22408, 22824, 22490, 21760, 21657, 22814, 24564, 25368, 24400, 22543, 21523, 21997, 22785, 22243, 20282, 18698, 19352, 22150, 25071, 26239, 25812, 25668, 27269, 30075, 32203, 32452, 31348, 30173, 29431, 28656, 27536, 26518, 25974, 25203, 22927, 18874, 14371, 11036, 9125, 7592, 5664, 3870, 3235, 3792, 4331, 3676, 1913, 198, -494, -224, 222, 246, -65, -230, -158},
+    {-158, 220, 452, -210, -1885, -3652, -4337, -3808, -3234, -3853, -5652, -7593, -9130, -11031, -14361, -18867, -22925, -25202, -25970, -26512, -27532, -28653, -29427, -30169, -31344, -32448, -32199, -30071, -27265, -25664, -25808, -26235, -25068, -22146, -19348, -18694, -20278, -22239, -22781, -21993, -21519, -22539, -24396, -25364, -24560, -22810, -21653, -21756, -22486, -22820, -22404, -21754, -21677, -22594, -24190, -25439, -25090, -22521, -18425, -14512, -12248, -11680, -11580, -10781, -9295, -8019, -7499, -7228, -6242, -4226, -1841, -84, 466, -208, -1825, -3936, -5929, -7243, -7751, -7801, -7728, -7374, -6246, -4196, -1826, -128, 263, -550, -2026, -3740, -5611, -7646, -9590, -10955, -11435, -11247, -10970, -10999, -11212, -11253, -11051, -10919, -11078, -11291, -11151, -10725, -10646, -11445, -12899, -14240, -14937, -15068, -14892, -14332, -13103, -11239, -9196, -7355, -5628, -3735, -1767, -254, 361, 197, -176, -256, 3, 261, 177, -197, -358, 262, 1776, 3741, 5631, 7358, 9200, 11243, 13107, 14335, 14895, 15072, 14941, 14244, 12903, 11449, 10650, 10729, 11155, 11295, 11082, 10923, 11056, 11257, 11216, 11003, 10975, 11251, 11439, 10959, 9594, 7651, 5615, 3742, 2026, 551, -259, 135, 1834, 4202, 6250, 7377, 7732, 7805, 7755, 7247, 5933, 3940, 1829, 212, -462, 88, 1845, 4230, 6246, 7232, 7503, 8023, 9299, 10785, 11584, 11684, 12251, 14516, 18428, 22525, 25093, 25443, 24194, 22598, 21681, 21758, 22408, 22824, 22490, 21760, 21657, 22814, 24564, 25368, 24400, 22543, 21523, 21997, 22785, 22243, 20282, 18698, 19352, 22150, 25071, 26239, 25812, 25668, 27269, 30075, 32203, 32452, 31348, 30173, 29431, 28656, 27536, 26518, 25974, 25203, 22927, 18874, 14371, 11036, 9125, 7592, 5664, 3870, 3235, 3792, 4331, 3676, 1913, 198, -494, -224, 222, 246, -65, -230, -158},
+    {-150, 218, 449, -205, -1888, -3652, -4335, -3811, -3233, -3852, -5654, -7592, -9130, -11032, -14360, -18868, -22926, -25201, -25971, -26512, -27531, -28654, -29426, -30169, -31345, -32447, -32199, -30072, -27264, -25664, -25808, -26234, -25068, -22146, -19347, -18695, -20278, -22239, -22782, -21993, -21519, -22539, -24395, -25364, -24560, -22810, -21653, -21756, -22486, -22820, -22404, -21754, -21677, -22594, -24190, -25440, -25089, -22521, -18425, -14512, -12248, -11680, -11580, -10781, -9295, -8019, -7499, -7228, -6242, -4226, -1841, -84, 466, -208, -1825, -3936, -5929, -7243, -7751, -7801, -7728, -7374, -6246, -4196, -1826, -128, 263, -550, -2026, -3740, -5611, -7646, -9590, -10955, -11435, -11247, -10970, -10999, -11212, -11253, -11051, -10919, -11078, -11291, -11151, -10725, -10646, -11445, -12899, -14240, -14937, -15068, -14892, -14332, -13103, -11239, -9196, -7355, -5628, -3735, -1767, -254, 361, 197, -176, -256, 3, 261, 177, -197, -358, 262, 1776, 3741, 5631, 7358, 9200, 11243, 13107, 14335, 14895, 15072, 14941, 14244, 12903, 11449, 10650, 10729, 11155, 11295, 11082, 10923, 11056, 11257, 11216, 11003, 10975, 11251, 11439, 10959, 9594, 7651, 5615, 3742, 2026, 551, -259, 135, 1834, 4202, 6250, 7377, 7732, 7805, 7755, 7247, 5933, 3940, 1829, 212, -462, 88, 1845, 4230, 6247, 7232, 7503, 8023, 9299, 10785, 11584, 11684, 12251, 14516, 18428, 22525, 25093, 25443, 24194, 22598, 21681, 21758, 22408, 22824, 22491, 21760, 21657, 22815, 24563, 25368, 24400, 22542, 21523, 21997, 22785, 22244, 20282, 18698, 19353, 22150, 25071, 26239, 25811, 25668, 27269, 30074, 32203, 32452, 31347, 30174, 29431, 28656, 27537, 26517, 25974, 25204, 22926, 18874, 14372, 11034, 9126, 7592, 5663, 3872, 3235, 3791, 4334, 3674, 1912, 201, -498, -223, 226, 237, -52, -242, -150},
+    {207, 266, 26, -696, -1829, -3020, -3843, -4110, -4051, -4191, -5023, -6718, -9118, -11959, -15090, -18453, -21856, -24820, -26770, -27493, -27463, -27633, -28739, -30652, -32365, -32745, -31444, -29224, -27345, -26526, -26387, -25860, -24233, -21863, -19925, -19405, -20270, -21556, -22274, -22262, -22198, -22783, -23939, -24811, -24589, -23334, -21987, -21518, -22034, -22727, -22728, -22038, -21586, -22313, -24099, -25604, -25240, -22471, -18301, -14514, -12342, -11684, -11473, -10748, -9426, -8136, -7400, -7014, -6217, -4462, -2037, 44, 774, -128, -2096, -4214, -5848, -6901, -7585, -8021, -8053, -7396, -5947, -3951, -1928, -444, 118, -358, -1731, -3694, -5867, -7899, -9535, -10652, -11249, -11412, -11293, -11077, -10937, -10964, -11120, -11266, -11259, -11065, -10811, -10715, -10979, -11679, -12730, -13901, -14877, -15352, -15132, -14222, -12811, -11153, -9404, -7565, -5581, -3522, -1664, -365, 195, 167, -55, -129, 2, 133, 58, -165, -192, 371, 1672, 3529, 5586, 7568, 9406, 11156, 12816, 14226, 15135, 15354, 14880, 13905, 12735, 11684, 10982, 10718, 10814, 11070, 11263, 11271, 11124, 10968, 10942, 11082, 11298, 11416, 11252, 10656, 9540, 7904, 5871, 3695, 1732, 359, -113, 450, 1936, 3957, 5952, 7400, 8056, 8025, 7590, 6906, 5852, 4218, 2100, 132, -770, -40, 2040, 4466, 6221, 7018, 7404, 8140, 9430, 10752, 11477, 11688, 12346, 14517, 18304, 22475, 25244, 25608, 24102, 22317, 21590, 22042, 22732, 22731, 22038, 21522, 21991, 23338, 24593, 24815, 23943, 22787, 22202, 22266, 22278, 21560, 20274, 19409, 19929, 21867, 24236, 25864, 26391, 26530, 27349, 29228, 31448, 32748, 32369, 30656, 28744, 27637, 27467, 27497, 26774, 24824, 21860, 18457, 15094, 11963, 9122, 6722, 5027, 4195, 4054, 4113, 3845, 3023, 1832, 699, -24, -267, -212, -90, -5, 81, 207},
+    {-317, -554, -859, -1223, -1630, -2068, -2544, -3097, -3796, -4734, -6003, -7675, -9776, -12268, -15051, -17968, -20838, -23479, -25746, -27553, -28879, -29767, -30296, -30558, -30623, -30524, -30251, -29758, -28990, -27916, -26554, -24988, -23366, -21878, -20720, -20049, -19944, -20381, -21235, -22298, -23327, -24096, -24445, -24323, -23793, -23018, -22219, -21622, -21395, -21606, -22202, -23018, -23812, -24325, -24333, -23709, -22442, -20643, -18518, -16311, -14253, -12507, -11133, -10087, -9239, -8422, -7483, -6335, -4988, -3558, -2237, -1252, -804, -1012, -1872, -3248, -4889, -6478, -7696, -8290, -8128, -7229, -5761, -4010, -2322, -1030, -397, -561, -1515, -3118, -5124, -7240, -9178, -10715, -11718, -12165, -12129, -11756, -11221, -10695, -10312, -10151, -10236, -10541, -11013, -11586, -12197, -12795, -13339, -13791, -14109, -14240, -14118, -13677, -12858, -11635, -10027, -8110, -6015, -3914, -2001, -451, 603, 1105, 1083, 653, 1, -650, -1079, -1101, -599, 456, 2006, 3920, 6020, 8115, 10032, 11639, 12861, 13680, 14122, 14243, 14113, 13795, 13343, 12800, 12202, 11590, 11017, 10545, 10240, 10155, 10316, 10700, 11226, 11761, 12134, 12169, 11722, 10718, 9182, 7243, 5127, 3121, 1519, 564, 401, 1034, 2326, 4015, 5766, 7233, 8132, 8294, 7700, 6482, 4892, 3251, 1875, 1015, 808, 1256, 2241, 3562, 4993, 6339, 7487, 8426, 9243, 10090, 11137, 12510, 14257, 16315, 18522, 20647, 22445, 23713, 24337, 24329, 23816, 23022, 22206, 21610, 21399, 21626, 22223, 23022, 23797, 24327, 24449, 24100, 23331, 22302, 21239, 20385, 19947, 20053, 20724, 21882, 23370, 24992, 26559, 27921, 28994, 29762, 30255, 30528, 30626, 30561, 30300, 29771, 28884, 27557, 25751, 23483, 20842, 17972, 15054, 12272, 9779, 7679, 6007, 4738, 3801, 3102, 2548, 2072, 1633, 1224, 857, 550, 312, 136, -3, -142, -317},
+    {534, 675, 671, 481, 73, -575, -1480, -2643, -4059, -5712, -7574, -9610, -11778, -14030, -16313, -18572, -20752, -22803, -24674, -26324, -27717, -28828, -29639, -30146, -30352, -30273, -29933, -29365, -28608, -27708, -26714, -25676, -24643, -23661, -22773, -22014, -21411, -20983, -20740, -20680, -20793, -21061, -21456, -21945, -22489, -23046, -23575, -24032, -24379, -24581, -24610, -24445, -24071, -23486, -22693, -21704, -20540, -19228, -17801, -16293, -14744, -13192, -11675, -10228, -8880, -7658, -6581, -5661, -4905, -4312, -3876, -3583, -3419, -3364, -3396, -3494, -3637, -3804, -3980, -4151, -4308, -4448, -4568, -4673, -4771, -4871, -4985, -5126, -5306, -5538, -5831, -6192, -6624, -7127, -7694, -8319, -8988, -9684, -10390, -11083, -11743, -12348, -12877, -13311, -13634, -13833, -13900, -13831, -13625, -13286, -12824, -12249, -11576, -10822, -10004, -9141, -8250, -7346, -6445, -5556, -4689, -3848, -3035, -2248, -1484, -737, 2, 741, 1489, 2253, 3039, 3852, 4693, 5560, 6449, 7350, 8254, 9145, 10008, 10826, 11580, 12253, 12828, 13290, 13629, 13835, 13905, 13837, 13638, 13315, 12881, 12352, 11747, 11087, 10394, 9688, 8992, 8323, 7698, 7130, 6628, 6196, 5835, 5542, 5310, 5130, 4989, 4875, 4775, 4678, 4572, 4452, 4313, 4155, 3984, 3808, 3641, 3498, 3400, 3368, 3423, 3587, 3879, 4316, 4909, 5665, 6585, 7662, 8884, 10232, 11679, 13196, 14748, 16297, 17805, 19232, 20544, 21708, 22696, 23490, 24075, 24448, 24614, 24585, 24383, 24036, 23579, 23050, 22493, 21949, 21461, 21065, 20798, 20684, 20744, 20987, 21415, 22018, 22777, 23665, 24647, 25680, 26718, 27712, 28611, 29368, 29937, 30277, 30356, 30150, 29643, 28832, 27721, 26328, 24679, 22808, 20758, 18577, 16318, 14035, 11783, 9614, 7578, 5715, 4062, 2645, 1481, 576, -74, -482, -672, -677, -536, -294, -1, 292, 534},
+    {-2160, -3236, -4309, -5376, -6436, -7488, -8531, -9562, -10581, -11586, -12575, -13547, -14500, -15433, -16343, -17230, -18091, -18925, -19729, -20503, -21244, -21949, -22619, -23250, -23841, -24389, -24894, -25354, -25767, -26130, -26444, -26707, -26916, -27073, -27174, -27220, -27210, -27144, -27021, -26842, -26607, -26317, -25972, -25573, -25123, -24622, -24074, -23479, -22841, -22162, -21446, -20696, -19916, -19110, -18281, -17434, -16575, -15706, -14834, -13963, -13097, -12243, -11404, -10586, -9794, -9032, -8305, -7616, -6971, -6373, -5824, -5329, -4890, -4509, -4189, -3929, -3732, -3598, -3526, -3515, -3565, -3674, -3839, -4058, -4327, -4643, -5001, -5397, -5826, -6283, -6761, -7255, -7759, -8268, -8773, -9270, -9751, -10212, -10644, -11044, -11404, -11720, -11987, -12199, -12354, -12447, -12476, -12437, -12329, -12150, -11900, -11579, -11187, -10725, -10196, -9602, -8945, -8230, -7461, -6642, -5779, -4876, -3941, -2979, -1997, -1001, 2, 1005, 2001, 2983, 3945, 4881, 5783, 6646, 7465, 8234, 8949, 9606, 10200, 10729, 11191, 11583, 11904, 12154, 12333, 12441, 12480, 12451, 12358, 12203, 11991, 11724, 11408, 11048, 10648, 10216, 9756, 9274, 8777, 8272, 7764, 7259, 6765, 6287, 5830, 5401, 5005, 4647, 4331, 4062, 3843, 3678, 3569, 3519, 3530, 3602, 3736, 3933, 4193, 4513, 4894, 5333, 5828, 6376, 6975, 7620, 8309, 9036, 9798, 10590, 11408, 12246, 13101, 13966, 14838, 15710, 16578, 17438, 18285, 19113, 19920, 20700, 21450, 22166, 22845, 23483, 24078, 24627, 25127, 25578, 25976, 26321, 26612, 26847, 27026, 27148, 27215, 27225, 27178, 27077, 26921, 26711, 26449, 26135, 25771, 25358, 24899, 24393, 23845, 23254, 22623, 21953, 21247, 20506, 19733, 18928, 18094, 17233, 16346, 15435, 14502, 13549, 12577, 11588, 10583, 9564, 8532, 7489, 6437, 5377, 4310, 3237, 2160, 1081, 0, -1080, -2160},
+    {-1323, -1983, -2640, -3295, -3945, -4591, -5231, -5865, -6493, -7112, -7723, -8325, -8918, -9500, -10070, -10629, -11176, -11710, -12230, -12737, -13229, -13705, -14167, -14612, -15041, -15454, -15849, -16227, -16588, -16930, -17254, -17560, -17847, -18116, -18366, -18597, -18809, -19002, -19176, -19331, -19467, -19585, -19684, -19764, -19826, -19870, -19896, -19904, -19895, -19869, -19827, -19767, -19692, -19602, -19496, -19375, -19240, -19091, -18928, -18753, -18565, -18365, -18154, -17932, -17699, -17456, -17205, -16944, -16675, -16398, -16114, -15824, -15527, -15225, -14918, -14606, -14290, -13970, -13648, -13323, -12996, -12667, -12337, -12006, -11675, -11343, -11012, -10682, -10353, -10026, -9700, -9376, -9054, -8735, -8418, -8105, -7794, -7487, -7183, -6883, -6586, -6293, -6003, -5718, -5436, -5158, -4883, -4613, -4346, -4082, -3822, -3565, -3312, -3061, -2814, -2569, -2327, -2087, -1849, -1614, -1380, -1147, -916, -685, -456, -227, 2, 231, 460, 689, 920, 1151, 1384, 1618, 1853, 2091, 2331, 2573, 2818, 3066, 3316, 3569, 3826, 4086, 4350, 4617, 4887, 5162, 5440, 5722, 6007, 6297, 6590, 6887, 7187, 7491, 7798, 8109, 8422, 8739, 9058, 9380, 9704, 10030, 10357, 10686, 11017, 11347, 11679, 12010, 12341, 12671, 13000, 13327, 13652, 13974, 14294, 14610, 14922, 15229, 15531, 15828, 16118, 16402, 16679, 16948, 17209, 17460, 17703, 17936, 18158, 18369, 18569, 18757, 18932, 19095, 19244, 19379, 19499, 19605, 19696, 19771, 19830, 19873, 19899, 19908, 19899, 19873, 19829, 19767, 19687, 19588, 19471, 19334, 19179, 19005, 18812, 18600, 18369, 18119, 17851, 17563, 17258, 16933, 16591, 16230, 15852, 15457, 15045, 14615, 14170, 13708, 13232, 12740, 12233, 11713, 11179, 10632, 10073, 9502, 8921, 8328, 7726, 7115, 6495, 5868, 5234, 4594, 3948, 3297, 2643, 1985, 1325, 664, 1, -661, -1323},
 };
@@ -41,6 +41,8 @@
 
 #include "userosc.h"
 #include "biquad.hpp"
+#include "phaseacc.hpp"
+#include "noise.hpp"
 
 struct Waves {
 
@@ -81,12 +83,9 @@ struct Waves {
     const float   *wave0;
     const float   *wave1;
     const float   *subwave;
-          float    phi0;
-          float    phi1;
-          float    phisub;
-          float    w00;
-          float    w01;
-          float    w0sub;
+    dsp::PhaseAcc  phase0;
+    dsp::PhaseAcc  phase1;
+    dsp::PhaseAcc  phasesub;
           float    lfo;
           float    lfoz;
           float    dither;
@@ -99,9 +98,6 @@ struct Waves {
       wave0(wavesA[0]),
       wave1(wavesD[0]),
       subwave(wavesA[0]),
-      w00(440.f * k_samplerate_recipf),
-      w01(440.f * k_samplerate_recipf),
-      w0sub(220.f * k_samplerate_recipf),
       lfo(0.f),
       lfoz(0.f),
       dither(0.f),
@@ -109,19 +105,78 @@ struct Waves {
       bitresrcp(1.f),
       flags(k_flags_none)
     {
+      phase0.setW0(440.f * k_samplerate_recipf);
+      phase1.setW0(440.f * k_samplerate_recipf);
+      phasesub.setW0(220.f * k_samplerate_recipf);
       reset();
       imperfection = osc_white() * 1.0417e-006f; // +/- 0.05Hz@48KHz
     }
     
     inline void reset(void)
     {
-      phi0 = 0;
-      phi1 = 0;
-      phisub = 0;
+      phase0.reset();
+      phase1.reset();
+      phasesub.reset();
       lfo = lfoz;
     }
   };
 
+  /**
+   * Blend of wave0 and wave1 at a fixed mix and phase offset, so that a static shape costs a single scan per sample.
+   * Rebuilt k_chunk entries per block, playback keeps using the cache during small refreshes and falls back to
+   * dual scanning otherwise.
+   */
+  struct BlendCache {
+    enum {
+      k_chunk = k_waves_size / 4
+    };
+
+    /** Offset drift tolerated before refreshing, a quarter of a table point */
+    static const uint32_t k_delta_tol = 1U << (k_waves_u32shift - 2);
+    /** Mix change that can be refreshed while playing from the cache */
+    static constexpr float k_mix_tol = 1.f / 64;
+
+    float    table[k_waves_size];
+    float    mix;
+    uint32_t delta;
+    uint16_t pos;
+    uint8_t  valid;
+
+    BlendCache(void) :
+      mix(0.f),
+      delta(0),
+      pos(k_waves_size),
+      valid(0)
+    { }
+
+    inline void invalidate(void) {
+      valid = 0;
+      pos = k_waves_size;
+    }
+
+    /** Start a sweep if stale, rebuild one chunk, and report whether the cache can be played for this block */
+    inline bool update(const float *w0, const float *w1, const float m, const uint32_t d) {
+      if (pos == k_waves_size) {
+        const uint32_t drift = d - delta + k_delta_tol;
+        if (valid && m == mix && drift <= 2 * k_delta_tol)
+          return true;
+        if (si_fabsf(m - mix) > k_mix_tol)
+          valid = 0;
+        mix = m;
+        delta = d;
+        pos = 0;
+      }
+      const float m0 = 1.f - mix;
+      const uint32_t e = pos + k_chunk;
+      for (uint32_t i = pos; i < e; ++i)
+        table[i] = m0 * w0[i] + mix * osc_wave_scanuf(w1, (i << k_waves_u32shift) + delta);
+      pos = e;
+      if (pos == k_waves_size)
+        valid = 1;
+      return valid;
+    }
+  };
+
   Waves(void) {
     init();
   }
@@ -136,14 +191,16 @@ struct Waves {
   inline void updatePitch(float w0) {
     w0 += state.imperfection;
     const float drift = params.shiftshape;
-    state.w00 = w0;
+    state.phase0.setW0(w0);
     // Alt osc with slight drift (0.25Hz@48KHz)
-    state.w01 = w0 + drift * 5.20833333333333e-006f;
+    state.phase1.setW0(w0 + drift * 5.20833333333333e-006f);
     // Sub one octave and a phase drift (0.15Hz@48KHz)
-    state.w0sub = 0.5f * w0 + drift * 3.125e-006f;
+    state.phasesub.setW0(0.5f * w0 + drift * 3.125e-006f);
   }
     
   inline void updateWaves(const uint16_t flags) {
+    if (flags & (k_flag_wave0 | k_flag_wave1))
+      cache.invalidate();
     if (flags & k_flag_wave0) {
       static const uint8_t k_a_thr = k_waves_a_cnt;
       static const uint8_t k_b_thr = k_a_thr + k_waves_b_cnt;
@@ -195,5 +252,7 @@ struct Waves {
 
   State       state;
   Params      params;
+  BlendCache  cache;
   dsp::BiQuad prelpf, postlpf;
+  dsp::Noise  noise;
 };
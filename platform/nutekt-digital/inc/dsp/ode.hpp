@@ -0,0 +1,769 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    ode.hpp
+ * @brief   ODE integrators, nonlinear models and oscillator/filter wrappers.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+#include "fixed_math.h"
+#include "oversampler.hpp"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /*===========================================================================*/
+  /* Integrators.                                                              */
+  /*===========================================================================*/
+
+  /**
+   * Integrators advance the state x of a model by one step h in place.
+   *
+   * A model is a small value type with a constexpr constructor, copied into locals for the duration of a block.
+   * It provides:
+   *  - kDim, number of state variables
+   *  - kSplit, state variables [0, kSplit) are positions updated after the others, 0 if not applicable
+   *  - kOut, state variable rendered by default
+   *  - f(x, dx), the derivative
+   *  - jacobian(x, J), row major kDim x kDim, only needed by OdeTrapezoidal
+   *  - setInput(u), driven models only, see OdeFilter
+   *
+   * All loops run over kDim, a compile time constant, so they are fully unrolled and the state stays in registers.
+   *
+   * warp(wh) returns the angular step to give a model so that its linear part oscillates at wh radians
+   * per step once discretized, compensating each integrator's frequency error.
+   */
+
+  /**
+   * Semi-implicit (symplectic) Euler: velocities first, then positions from the updated velocities.
+   * One derivative evaluation, the second one only needs the position rows and the rest is dead code once inlined.
+   * Keeps oscillators on their orbit where explicit Euler spirals out, plain Euler when kSplit is 0.
+   */
+  struct OdeSemiImplicitEuler {
+    /** Discrete frequency satisfies 2 sin(wd h / 2) = w h */
+    static inline float warp(const float wh)
+    {
+      return 2.f * sinf_o7(0.5f * wh);
+    }
+
+    template <typename Model>
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void step(const Model &m, float *x, const float h)
+    {
+      float d[Model::kDim];
+      m.f(x, d);
+      for (uint32_t i = Model::kSplit; i < Model::kDim; ++i)
+        x[i] += h * d[i];
+      if (Model::kSplit) {
+        m.f(x, d);
+        for (uint32_t i = 0; i < Model::kSplit; ++i)
+          x[i] += h * d[i];
+      }
+    }
+  };
+
+  /**
+   * Second order Runge-Kutta, midpoint rule. Two evaluations.
+   */
+  struct OdeRK2 {
+    /** Frequency error is small before amplitude drift, left uncompensated */
+    static inline float warp(const float wh)
+    {
+      return wh;
+    }
+
+    template <typename Model>
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void step(const Model &m, float *x, const float h)
+    {
+      float d[Model::kDim], t[Model::kDim];
+      m.f(x, d);
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        t[i] = x[i] + 0.5f * h * d[i];
+      m.f(t, d);
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        x[i] += h * d[i];
+    }
+  };
+
+  /**
+   * Classic fourth order Runge-Kutta. Four evaluations.
+   */
+  struct OdeRK4 {
+    /** Frequency error is negligible at audio rates */
+    static inline float warp(const float wh)
+    {
+      return wh;
+    }
+
+    template <typename Model>
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void step(const Model &m, float *x, const float h)
+    {
+      float k[Model::kDim], s[Model::kDim], t[Model::kDim];
+      m.f(x, k);
+      for (uint32_t i = 0; i < Model::kDim; ++i) {
+        s[i] = k[i];
+        t[i] = x[i] + 0.5f * h * k[i];
+      }
+      m.f(t, k);
+      for (uint32_t i = 0; i < Model::kDim; ++i) {
+        s[i] += 2.f * k[i];
+        t[i] = x[i] + 0.5f * h * k[i];
+      }
+      m.f(t, k);
+      for (uint32_t i = 0; i < Model::kDim; ++i) {
+        s[i] += 2.f * k[i];
+        t[i] = x[i] + h * k[i];
+      }
+      m.f(t, k);
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        x[i] += (h / 6.f) * (s[i] + k[i]);
+    }
+  };
+
+  /**
+   * Implicit trapezoidal rule, A-stable for stiff models.
+   *
+   * Solves z = x + h/2 (f(x) + f(z)) with a fixed number of Newton iterations started from z = x, so cost per
+   * step is constant. The first iteration reuses f(x) and is the linearly implicit trapezoidal rule, second order
+   * on its own: one evaluation, one Jacobian and one kDim x kDim solve. Each further iteration adds one of each.
+   *
+   * @tparam Iter Newton iterations, 1 is usually enough at audio rates.
+   */
+  template <uint32_t Iter = 1>
+  struct OdeTrapezoidal {
+    /** Same warping as the bilinear transform, tan(wd h / 2) = w h / 2 */
+    static inline float warp(const float wh)
+    {
+      return 2.f * sinf_o7(0.5f * wh) / cosf_o7(0.5f * wh);
+    }
+
+    template <typename Model>
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void step(const Model &m, float *x, const float h)
+    {
+      const uint32_t n = Model::kDim;
+      float fx[n], z[n], fz[n], r[n], J[n * n];
+      m.f(x, fx);
+      for (uint32_t i = 0; i < n; ++i)
+        z[i] = x[i];
+      for (uint32_t it = 0; it < Iter; ++it) {
+        // Residual and its Jacobian I - h/2 Jf(z)
+        if (it)
+          m.f(z, fz);
+        else
+          for (uint32_t i = 0; i < n; ++i)
+            fz[i] = fx[i];
+        m.jacobian(z, J);
+        for (uint32_t i = 0; i < n; ++i) {
+          r[i] = z[i] - x[i] - 0.5f * h * (fx[i] + fz[i]);
+          for (uint32_t j = 0; j < n; ++j)
+            J[i * n + j] = ((i == j) ? 1.f : 0.f) - 0.5f * h * J[i * n + j];
+        }
+        solve<n>(J, r);
+        for (uint32_t i = 0; i < n; ++i)
+          z[i] -= r[i];
+      }
+      for (uint32_t i = 0; i < n; ++i)
+        x[i] = z[i];
+    }
+
+    /**
+     * Solve A x = b in place by Gaussian elimination, no pivoting as A is close to identity for small h
+     */
+    template <uint32_t N>
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void solve(float *A, float *b)
+    {
+      if (N == 2) {
+        // Cramer's rule, a single division
+        const float r = 1.f / (A[0] * A[3] - A[1] * A[2]);
+        const float b0 = b[0];
+        b[0] = r * (A[3] * b0 - A[1] * b[1]);
+        b[1] = r * (A[0] * b[1] - A[2] * b0);
+        return;
+      }
+      float p[N];
+      for (uint32_t k = 0; k < N; ++k) {
+        p[k] = 1.f / A[k * N + k];
+        for (uint32_t i = k + 1; i < N; ++i) {
+          const float l = A[i * N + k] * p[k];
+          for (uint32_t j = k + 1; j < N; ++j)
+            A[i * N + j] -= l * A[k * N + j];
+          b[i] -= l * b[k];
+        }
+      }
+      for (uint32_t k = N; k-- > 0; ) {
+        float s = b[k];
+        for (uint32_t j = k + 1; j < N; ++j)
+          s -= A[k * N + j] * b[j];
+        b[k] = s * p[k];
+      }
+    }
+  };
+
+  /*===========================================================================*/
+  /* Models.                                                                   */
+  /*===========================================================================*/
+
+  /**
+   * Van der Pol oscillator, x' = y, y' = mu (1 - x^2) y - w^2 x
+   *
+   * Time unit is one sample: w is the angular frequency in radians per sample, mu the damping per sample.
+   * Settles on a limit cycle of amplitude ~2, sinusoidal for small mu, relaxation oscillation for mu >> w.
+   */
+  struct OdeVanDerPol {
+
+    static constexpr uint32_t kDim = 2;
+    static constexpr uint32_t kSplit = 1;
+    static constexpr uint32_t kOut = 0;
+
+    constexpr OdeVanDerPol(const float w = 0.f, const float mu = 0.f) : mMu(mu), mW2(w * w) { }
+
+    /**
+     * @param w Angular frequency, radians per time unit, see the integrators' warp()
+     */
+    inline void setW(const float w)
+    {
+      mW2 = w * w;
+    }
+
+    /**
+     * @param mu Damping in per sample units
+     */
+    inline void setMu(const float mu)
+    {
+      mMu = mu;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void f(const float *x, float *d) const
+    {
+      d[0] = x[1];
+      d[1] = mMu * (1.f - x[0] * x[0]) * x[1] - mW2 * x[0];
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void jacobian(const float *x, float *J) const
+    {
+      J[0] = 0.f;
+      J[1] = 1.f;
+      J[2] = -2.f * mMu * x[0] * x[1] - mW2;
+      J[3] = mMu * (1.f - x[0] * x[0]);
+    }
+
+    float mMu;
+    float mW2;
+  };
+
+  /**
+   * Lorenz system, x' = sigma (y - x), y' = x (rho - z) - y, z' = x y - beta z
+   *
+   * Chaotic for the classic sigma = 10, rho = 28, beta = 8/3. x and y stay within about +-25 and z in [0, 50].
+   * The orbit circles each lobe at roughly 1.3 cycles per time unit, set the pitch with setRate().
+   * Not stiff, explicit integrators are fine.
+   */
+  struct OdeLorenz {
+
+    static constexpr uint32_t kDim = 3;
+    static constexpr uint32_t kSplit = 0;
+    static constexpr uint32_t kOut = 0;
+
+    constexpr OdeLorenz(const float sigma = 10.f, const float rho = 28.f, const float beta = 8.f / 3.f,
+                        const float rate = 0.f) :
+      mSigma(sigma), mRho(rho), mBeta(beta), mRate(rate) { }
+
+    inline void setParams(const float sigma, const float rho, const float beta)
+    {
+      mSigma = sigma;
+      mRho = rho;
+      mBeta = beta;
+    }
+
+    /**
+     * @param rate Model time units per sample
+     */
+    inline void setRate(const float rate)
+    {
+      mRate = rate;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void f(const float *x, float *d) const
+    {
+      d[0] = mRate * mSigma * (x[1] - x[0]);
+      d[1] = mRate * (x[0] * (mRho - x[2]) - x[1]);
+      d[2] = mRate * (x[0] * x[1] - mBeta * x[2]);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void jacobian(const float *x, float *J) const
+    {
+      J[0] = -mRate * mSigma;
+      J[1] = mRate * mSigma;
+      J[2] = 0.f;
+      J[3] = mRate * (mRho - x[2]);
+      J[4] = -mRate;
+      J[5] = -mRate * x[0];
+      J[6] = mRate * x[1];
+      J[7] = mRate * x[0];
+      J[8] = -mRate * mBeta;
+    }
+
+    float mSigma;
+    float mRho;
+    float mBeta;
+    float mRate;
+  };
+
+  /**
+   * Duffing oscillator driven by an input, x' = y, y' = u - delta y - w^2 (x + beta x^3)
+   *
+   * A resonator whose pitch rises with amplitude for beta > 0. Driven with a sine it goes through period
+   * doubling into chaos as the drive increases. Time unit is one sample as for OdeVanDerPol.
+   */
+  struct OdeDuffing {
+
+    static constexpr uint32_t kDim = 2;
+    static constexpr uint32_t kSplit = 1;
+    static constexpr uint32_t kOut = 0;
+
+    constexpr OdeDuffing(const float w = 0.f, const float delta = 0.f, const float beta = 0.f) :
+      mW2(w * w), mDelta(delta), mBeta(beta), mU(0.f) { }
+
+    /**
+     * @param w Angular frequency of the linear part, radians per sample, see the integrators' warp()
+     */
+    inline void setW(const float w)
+    {
+      mW2 = w * w;
+    }
+
+    /**
+     * @param delta Damping in per sample units
+     */
+    inline void setDamping(const float delta)
+    {
+      mDelta = delta;
+    }
+
+    /**
+     * @param beta Cubic stiffness, relative to the linear one
+     */
+    inline void setStiffness(const float beta)
+    {
+      mBeta = beta;
+    }
+
+    inline void setInput(const float u)
+    {
+      mU = u;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void f(const float *x, float *d) const
+    {
+      d[0] = x[1];
+      d[1] = mU - mDelta * x[1] - mW2 * x[0] * (1.f + mBeta * x[0] * x[0]);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void jacobian(const float *x, float *J) const
+    {
+      J[0] = 0.f;
+      J[1] = 1.f;
+      J[2] = -mW2 * (1.f + 3.f * mBeta * x[0] * x[0]);
+      J[3] = -mDelta;
+    }
+
+    float mW2;
+    float mDelta;
+    float mBeta;
+    float mU;
+  };
+
+  /**
+   * Four pole diode ladder lowpass, in the usual simplified form where each capacitor sees the difference of its
+   * neighbours through a tanh stage and the first stage runs twice as fast:
+   *
+   *   x0' = w   (T(u - k x3) - T(x0 - x1))
+   *   x1' = w/2 (T(x0 - x1)  - T(x1 - x2))
+   *   x2' = w/2 (T(x1 - x2)  - T(x2 - x3))
+   *   x3' = w/2 (T(x2 - x3)  - T(x3))
+   *
+   * With w = sqrt(2) wc the loop phase crosses -180 degrees at wc, where the filter resonates and, from k = 17,
+   * self-oscillates. The slope is gentle, without feedback the -3 dB point is near 0.1 wc. Output is x3,
+   * DC gain is 1 / (1 + k).
+   * T is a [3/2] Pade tanh clipped at +-3, exact derivative included. Stiff at high cutoff and resonance,
+   * use OdeTrapezoidal.
+   */
+  struct OdeDiodeLadder {
+
+    static constexpr uint32_t kDim = 4;
+    static constexpr uint32_t kSplit = 0;
+    static constexpr uint32_t kOut = 3;
+
+    constexpr OdeDiodeLadder(const float wc = 0.f, const float k = 0.f) : mW(M_SQRT2 * wc), mK(k), mU(0.f) { }
+
+    /**
+     * @param wc Cutoff, radians per sample, see the integrators' warp()
+     */
+    inline void setW(const float wc)
+    {
+      mW = M_SQRT2 * wc;
+    }
+
+    /**
+     * @param k Feedback gain
+     */
+    inline void setResonance(const float k)
+    {
+      mK = k;
+    }
+
+    inline void setInput(const float u)
+    {
+      mU = u;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void f(const float *x, float *d) const
+    {
+      float t0, t01, t12, t23, t3, dt;
+      sat(mU - mK * x[3], t0, dt);
+      sat(x[0] - x[1], t01, dt);
+      sat(x[1] - x[2], t12, dt);
+      sat(x[2] - x[3], t23, dt);
+      sat(x[3], t3, dt);
+      const float w2 = 0.5f * mW;
+      d[0] = mW * (t0 - t01);
+      d[1] = w2 * (t01 - t12);
+      d[2] = w2 * (t12 - t23);
+      d[3] = w2 * (t23 - t3);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void jacobian(const float *x, float *J) const
+    {
+      float t, g0, g01, g12, g23, g3;
+      sat(mU - mK * x[3], t, g0);
+      sat(x[0] - x[1], t, g01);
+      sat(x[1] - x[2], t, g12);
+      sat(x[2] - x[3], t, g23);
+      sat(x[3], t, g3);
+      const float w2 = 0.5f * mW;
+      J[0]  = -mW * g01;   J[1]  = mW * g01;            J[2]  = 0.f;                 J[3]  = -mW * mK * g0;
+      J[4]  = w2 * g01;    J[5]  = -w2 * (g01 + g12);   J[6]  = w2 * g12;            J[7]  = 0.f;
+      J[8]  = 0.f;         J[9]  = w2 * g12;            J[10] = -w2 * (g12 + g23);   J[11] = w2 * g23;
+      J[12] = 0.f;         J[13] = 0.f;                 J[14] = w2 * g23;            J[15] = -w2 * (g23 + g3);
+    }
+
+    /**
+     * tanh(x) ~ x (27 + x^2) / (27 + 9 x^2) on [-3, 3], derivative (9 - x^2)^2 / (9 (3 + x^2)^2)
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void sat(const float x, float &t, float &dt)
+    {
+      const float xc = clipminmaxf(-3.f, x, 3.f);
+      const float x2 = xc * xc;
+      const float r = 1.f / (3.f + x2);
+      const float n = 9.f - x2;
+      t = xc * (27.f + x2) * r * (1.f / 9.f);
+      dt = n * n * r * r * (1.f / 9.f);
+    }
+
+    float mW;
+    float mK;
+    float mU;
+  };
+
+  /*===========================================================================*/
+  /* Oversampling.                                                             */
+  /*===========================================================================*/
+
+  /**
+   * Halfband stage used at 2x, same coefficients as the first Oversampler stage
+   */
+  struct OdeHalfband : public HalfbandIIR<7> {
+    OdeHalfband(void)
+    {
+      static const float c[7] = {
+        0.050638919498f, 0.184204312981f, 0.358957975694f, 0.535346236459f,
+        0.691492524230f, 0.823840380268f, 0.941480938750f
+      };
+      setCoeffs(c);
+    }
+  };
+
+  /*===========================================================================*/
+  /* Oscillator.                                                               */
+  /*===========================================================================*/
+
+  /**
+   * Runs a model at Factor times the sample rate and outputs one state variable per sample.
+   *
+   * At 2x the output is decimated through the first stage of Oversampler, each step then covering half a sample.
+   *
+   * @tparam Model      Model type, see above.
+   * @tparam Integrator One of the Ode* integrators.
+   * @tparam Factor     Oversampling factor, 1 or 2.
+   */
+  template <typename Model, typename Integrator, uint32_t Factor = 1>
+  class OdeOsc {
+  public:
+
+    static_assert(Factor == 1 || Factor == 2, "OdeOsc oversampling factor must be 1 or 2");
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    OdeOsc(void)
+    {
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        mX[i] = 0.f;
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Model parameters
+     */
+    inline Model & model(void)
+    {
+      return mModel;
+    }
+
+    /**
+     * Set the model's angular frequency from a normalized frequency, compensated for the integrator
+     *
+     * @param w0 Normalized frequency, cycles per base rate sample
+     */
+    inline void setW0(const float w0)
+    {
+      const float h = 1.f / Factor;
+      mModel.setW(Integrator::warp(M_TWOPI * w0 * h) * Factor);
+    }
+
+    /**
+     * State variables
+     */
+    inline float * state(void)
+    {
+      return mX;
+    }
+
+    /**
+     * Set state and clear the decimator
+     *
+     * @param x0 Initial state, kDim values
+     */
+    inline void reset(const float *x0)
+    {
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        mX[i] = x0[i];
+      mDecimator.flush();
+    }
+
+    /**
+     * Render a block of one state variable, decimated to the base rate
+     *
+     * @param y      Output buffer of frames * Factor floats, frames first ones hold the result
+     * @param frames Number of base rate samples
+     * @param out    Index of the state variable to output
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(float *y, const uint32_t frames, const uint32_t out = Model::kOut)
+    {
+      // State and parameters in locals so that buffer stores cannot force reloads
+      const Model m = mModel;
+      float x[Model::kDim];
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        x[i] = mX[i];
+
+      const float h = 1.f / Factor;
+      float * p = y;
+      const float * p_e = y + frames * Factor;
+      for (; p != p_e; ) {
+        Integrator::step(m, x, h);
+        *(p++) = x[out];
+      }
+
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        mX[i] = x[i];
+
+      if (Factor == 2)
+        mDecimator.down_block(y, y, frames);
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+  private:
+
+    Model       mModel;
+    float       mX[Model::kDim];
+    OdeHalfband mDecimator;
+  };
+
+  /**
+   * Runs a driven model, one step per input sample, at Factor times the sample rate.
+   *
+   * At 2x the input is interpolated and the output decimated with the first stage of Oversampler.
+   *
+   * @tparam Model      Model type providing setInput(), see above.
+   * @tparam Integrator One of the Ode* integrators.
+   * @tparam Factor     Oversampling factor, 1 or 2.
+   */
+  template <typename Model, typename Integrator, uint32_t Factor = 1>
+  class OdeFilter {
+  public:
+
+    static_assert(Factor == 1 || Factor == 2, "OdeFilter oversampling factor must be 1 or 2");
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    OdeFilter(void)
+    {
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        mX[i] = 0.f;
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Model parameters
+     */
+    inline Model & model(void)
+    {
+      return mModel;
+    }
+
+    /**
+     * Set the model's angular frequency from a normalized frequency, compensated for the integrator
+     *
+     * @param w0 Normalized frequency, cycles per base rate sample
+     */
+    inline void setW0(const float w0)
+    {
+      const float h = 1.f / Factor;
+      mModel.setW(Integrator::warp(M_TWOPI * w0 * h) * Factor);
+    }
+
+    /**
+     * State variables
+     */
+    inline float * state(void)
+    {
+      return mX;
+    }
+
+    /**
+     * Clear state and resampling filters
+     */
+    inline void flush(void)
+    {
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        mX[i] = 0.f;
+      mInterpolator.flush();
+      mDecimator.flush();
+    }
+
+    /**
+     * Filter a block
+     *
+     * @param x      Input, frames samples
+     * @param y      Output buffer of frames * Factor floats, frames first ones hold the result. Must not overlap x at 2x.
+     * @param frames Number of base rate samples
+     * @param out    Index of the state variable to output
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(const float *x, float *y, const uint32_t frames, const uint32_t out = Model::kOut)
+    {
+      Model m = mModel;
+      float s[Model::kDim];
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        s[i] = mX[i];
+
+      if (Factor == 2) {
+        mInterpolator.up_block(x, y, frames);
+        x = y;
+      }
+
+      const float h = 1.f / Factor;
+      float * p = y;
+      const float * p_e = y + frames * Factor;
+      for (; p != p_e; ) {
+        m.setInput(*(x++));
+        Integrator::step(m, s, h);
+        *(p++) = s[out];
+      }
+
+      for (uint32_t i = 0; i < Model::kDim; ++i)
+        mX[i] = s[i];
+
+      if (Factor == 2)
+        mDecimator.down_block(y, y, frames);
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+  private:
+
+    Model       mModel;
+    float       mX[Model::kDim];
+    OdeHalfband mInterpolator;
+    OdeHalfband mDecimator;
+  };
+}
+
+/** @} */
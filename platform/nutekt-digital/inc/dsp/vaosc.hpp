@@ -0,0 +1,415 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    vaosc.hpp
+ * @brief   Band-limited virtual analog oscillator.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+#include "fixed_math.h"
+#include "buffer_ops.h"
+#include "phaseacc.hpp"
+#include "minblep_lut.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * Virtual analog oscillator with saw, pulse and triangle waves, hard sync and PWM.
+   *
+   * Discontinuities are detected with their sub-sample position and corrected either with
+   * 2-point PolyBLEP residuals (cheap) or with a minimum phase BLEP residual table of
+   * k_minblep_zero_crossings samples (higher quality, minblep_lut.h in flash).
+   * Slope discontinuities of the triangle use 2-point PolyBLAMP residuals in both modes.
+   *
+   * Output is delayed by one sample so PolyBLEP corrections can be applied to the sample
+   * preceding a discontinuity. Band-limited edges overshoot past [-1, 1], by up to ~60% for
+   * minBLEP steps, see kGain.
+   *
+   * Minimum phase steps lag the ideal step by k_minblep_delay samples on average while the
+   * ramps between them do not, which offsets the waveform by the slope times that delay.
+   * The offset is removed exactly for the saw (2*w0*delay) and per master period for the
+   * synced triangle, pulse steps cancel out.
+   *
+   * Memory footprint is ~100 bytes, plus 2KB of flash for the minBLEP table when used.
+   */
+  struct VAOsc {
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    enum {
+      k_saw = 0,
+      k_pulse,
+      k_triangle
+    };
+
+    enum {
+      k_polyblep = 0,
+      k_minblep
+    };
+
+    enum {
+      k_blep_size = k_minblep_zero_crossings,
+      k_blep_mask = k_blep_size - 1
+    };
+
+    /**
+     * Default block output gain, 1/1.6 from the peak of minBLEP edges below 8kHz with pulse widths in [0.1, 0.9].
+     * Narrower pulses and hard sync can peak higher and are saturated, PolyBLEP edges stay within ~1.
+     */
+    static constexpr float kGain = 0.62f;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Default constructor
+     */
+    VAOsc(void) :
+      mWave(k_saw), mMode(k_polyblep), mSync(0), mBlepPos(0),
+      mWidth(0.5f), mW0f(0.f), mW0Recip(0.f), mMasterW0f(0.f), mMasterW0Recip(0.f), mSyncStep(0.f), mDc(0.f), mZ(0.f)
+    {
+      buf_clr_f32(mBlep, k_blep_size);
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Reset phases and clear pending corrections
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void reset(void)
+    {
+      mPhase.reset();
+      mMaster.reset();
+      mZ = 0.f;
+      mSyncStep = 0.f;
+      updateDc();
+      buf_clr_f32(mBlep, k_blep_size);
+    }
+
+    /**
+     * Select waveform, one of k_saw, k_pulse, k_triangle
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setWave(const uint8_t wave)
+    {
+      mWave = wave;
+      mSyncStep = 0.f;
+      updateDc();
+    }
+
+    /**
+     * Select correction method, k_polyblep or k_minblep
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setMode(const uint8_t mode)
+    {
+      mMode = mode;
+      updateDc();
+    }
+
+    /**
+     * Set oscillator phase increment
+     *
+     * @param w Normalized phase increment in (0, 0.5), e.g. from osc_w0f_for_note()
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setW0(const float w)
+    {
+      mPhase.setW0(w);
+      mW0f = w;
+      mW0Recip = 1.f / (float)mPhase.w0;
+      updateDc();
+    }
+
+    /**
+     * Enable or disable hard sync and set master phase increment
+     *
+     * @param enable Non-zero to reset the oscillator on every master period.
+     * @param w      Normalized master phase increment in (0, 0.5)
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setSync(const uint8_t enable, const float w)
+    {
+      mSync = enable;
+      mMaster.setW0(w);
+      mMasterW0f = w;
+      mMasterW0Recip = 1.f / (float)mMaster.w0;
+      updateDc();
+    }
+
+    /**
+     * Set pulse width used by process() and process_block()
+     *
+     * @param width Pulse width in (0, 1)
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setPulseWidth(const float width)
+    {
+      mWidth = width;
+    }
+
+    /**
+     * Render one sample with the current pulse width
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float process(void)
+    {
+      return process(mWidth);
+    }
+
+    /**
+     * Render one sample
+     *
+     * @param width Pulse width in (0, 1) for this sample, allows per-sample PWM
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float process(const float width)
+    {
+      const uint32_t w0 = mPhase.w0;
+      const uint32_t th = (mWave == k_triangle) ? 0x80000000U : (uint32_t)(clipminmaxf(0.001f, width, 0.999f) * PhaseAcc::kQ32);
+
+      float cur = 0.f;     // corrections for the current sample
+      uint32_t phi0 = mPhase.phi;
+      uint32_t span = w0;  // phase travelled before a sync reset, if any
+      float dsync = 0.f;   // samples elapsed since the sync point
+
+      const uint8_t sync = mSync && mMaster.cycleWrapped();
+      if (sync) {
+        dsync = (float)mMaster.phi * mMasterW0Recip;
+        span = (uint32_t)((1.f - dsync) * (float)w0);
+      }
+
+      uint32_t phi1 = phi0 + span;
+
+      // Wrap around
+      if (~phi0 < span) {
+        const float d = dsync + (float)phi1 * mW0Recip;
+        switch (mWave) {
+        case k_saw:      addStep(cur, d, -2.f); break;
+        case k_pulse:    addStep(cur, d, 2.f); break;
+        case k_triangle: addRamp(cur, d, 8.f * mW0f); break;
+        }
+      }
+
+      // Pulse edge, triangle peak
+      if (mWave != k_saw && (uint32_t)(th - phi0 - 1) < span) {
+        const float d = dsync + (float)(phi1 - th) * mW0Recip;
+        if (mWave == k_pulse)
+          addStep(cur, d, -2.f);
+        else
+          addRamp(cur, d, -8.f * mW0f);
+      }
+
+      // Hard sync, restart from zero phase
+      if (sync) {
+        const float a = naive(0, th) - naive(phi1, th);
+        addStep(cur, dsync, a);
+        if (mWave == k_triangle) {
+          if (phi1 >= 0x80000000U)
+            addRamp(cur, dsync, 8.f * mW0f);
+          // Steps only come from sync, spread the lag of this one over the master period
+          mSyncStep = a;
+          updateDc();
+        }
+        phi1 = (uint32_t)(dsync * (float)w0);
+      }
+
+      mPhase.phi = phi1;
+
+      // Current sample, pending minBLEP residual for it, and one sample delayed output
+      cur += naive(phi1, th) + mBlep[mBlepPos] - mDc;
+      mBlep[mBlepPos] = 0.f;
+      mBlepPos = (mBlepPos + 1) & k_blep_mask;
+
+      const float out = mZ;
+      mZ = cur;
+      return out;
+    }
+
+    /**
+     * Render a block of samples to a Q31 buffer with the current pulse width
+     *
+     * @param y      Output buffer
+     * @param frames Number of samples
+     * @param gain   Output gain, keep some headroom for edge overshoot, values are saturated
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(q31_t * __restrict y, const uint32_t frames, const float gain = kGain)
+    {
+      const float width = mWidth;
+      const q31_t * y_e = y + frames;
+      for (; y != y_e; ) {
+        *(y++) = f32_to_q31_sat(gain * process(width));
+      }
+    }
+
+    /**
+     * Render a block of samples to a Q31 buffer, ramping pulse width across the block
+     *
+     * @param y         Output buffer
+     * @param frames    Number of samples
+     * @param width_end Pulse width at end of block, starts from the current width
+     * @param gain      Output gain, keep some headroom for edge overshoot, values are saturated
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block_pwm(q31_t * __restrict y, const uint32_t frames, const float width_end, const float gain = kGain)
+    {
+      float width = mWidth;
+      const float width_inc = (width_end - width) / frames;
+      const q31_t * y_e = y + frames;
+      for (; y != y_e; ) {
+        *(y++) = f32_to_q31_sat(gain * process(width));
+        width += width_inc;
+      }
+      mWidth = width_end;
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+    /**
+     * Offset of minBLEP output from the band-limited waveform, see class notes
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void updateDc(void)
+    {
+      if (mMode != k_minblep)
+        mDc = 0.f;
+      else if (mWave == k_saw)
+        mDc = 2.f * k_minblep_delay * mW0f;
+      else if (mWave == k_triangle && mSync)
+        mDc = -k_minblep_delay * mSyncStep * mMasterW0f; // from the last sync step, kept across setW0()
+      else
+        mDc = 0.f;
+    }
+
+    /**
+     * Naive waveform value at given phase
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float naive(const uint32_t phi, const uint32_t th) const
+    {
+      const float p = PhaseAcc::kQ32Recip * (float)phi;
+      switch (mWave) {
+      case k_pulse:
+        return (phi < th) ? 1.f : -1.f;
+      case k_triangle:
+        return (phi < 0x80000000U) ? 4.f * p - 1.f : 3.f - 4.f * p;
+      case k_saw:
+      default:
+        return 2.f * p - 1.f;
+      }
+    }
+
+    /**
+     * Add step discontinuity correction
+     *
+     * @param cur Correction accumulator for the current sample
+     * @param d   Samples elapsed between the discontinuity and the current sample, in [0, 1)
+     * @param a   Step amplitude
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void addStep(float &cur, const float d, const float a)
+    {
+      if (mMode == k_minblep) {
+        const float *lut = minblep_lut_f;
+        float x = clipmaxf(d, 0.9999f) * k_minblep_oversampling; // keep last read within the guard point
+        for (uint32_t k = 0; k < k_blep_size; ++k, x += k_minblep_oversampling) {
+          const uint32_t i = (uint32_t)x;
+          mBlep[(mBlepPos + k) & k_blep_mask] += a * linintf(x - i, lut[i], lut[i+1]);
+        }
+      }
+      else {
+        const float d1 = 1.f - d;
+        mZ += a * 0.5f * d * d;
+        cur -= a * 0.5f * d1 * d1;
+      }
+    }
+
+    /**
+     * Add slope discontinuity correction
+     *
+     * @param cur Correction accumulator for the current sample
+     * @param d   Samples elapsed between the discontinuity and the current sample, in [0, 1)
+     * @param s   Slope change, per sample
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void addRamp(float &cur, const float d, const float s)
+    {
+      const float d1 = 1.f - d;
+      mZ += s * (1.f/6.f) * d * d * d;
+      cur += s * (1.f/6.f) * d1 * d1 * d1;
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    PhaseAcc mPhase;
+    PhaseAcc mMaster;
+
+    uint8_t  mWave;
+    uint8_t  mMode;
+    uint8_t  mSync;
+    uint8_t  mBlepPos;
+
+    float    mWidth;
+    float    mW0f;
+    float    mW0Recip;
+    float    mMasterW0f;
+    float    mMasterW0Recip;
+    float    mSyncStep;
+    float    mDc;
+    float    mZ;
+    float    mBlep[k_blep_size];
+  };
+}
+
+/** @} */
@@ -0,0 +1,280 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    wavetable.hpp
+ * @brief   Mipmapped wavetable oscillator with frame morphing.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+#include "int_math.h"
+#include "fixed_math.h"
+#include "phaseacc.hpp"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * Per storage format fraction and interpolation, specialized for each supported type
+   */
+  template <typename T>
+  struct WavetableSample;
+
+  template <>
+  struct WavetableSample<float> {
+    typedef float frac_t;
+
+    /** Scale from interpolated value to [-1, 1] */
+    static constexpr float kScale = 1.f;
+
+    /** Interpolation fraction from Q32 phase */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    frac_t frac(const uint32_t phi, const uint32_t size_exp)
+    {
+      return PhaseAcc::kQ32Recip * (float)(phi << size_exp);
+    }
+
+    /** Interpolate between p[0] and p[1] */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float linint(const float *p, const frac_t fr)
+    {
+      return linintf(fr, p[0], p[1]);
+    }
+  };
+
+  template <>
+  struct WavetableSample<int16_t> {
+    typedef uint32_t frac_t;
+
+    /** Scale from interpolated value to [-1, 1], applied once after morphing */
+    static constexpr float kScale = k_q15_linint_recipf;
+
+    /** Interpolation fraction from Q32 phase, in Q14 */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    frac_t frac(const uint32_t phi, const uint32_t size_exp)
+    {
+      return (phi << size_exp) >> (32 - k_q15_linint_fr_bits);
+    }
+
+    /** Interpolate between p[0] and p[1] in fixed point, converting to float once, unscaled */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float linint(const int16_t *p, const frac_t fr)
+    {
+      return (float)q15_linint_pair(p, fr);
+    }
+  };
+
+  /**
+   * Wavetable oscillator over band-limited per-octave mipmaps, as generated by tools/wavetable/wavetable.py.
+   *
+   * Table layout is [frame][level][point], level l holding at most (size/2)>>l harmonics, each level
+   * followed by a guard point equal to its first point so that both interpolation points are adjacent.
+   * The mip level is selected once per phase increment change so that no harmonic exceeds Nyquist,
+   * the morph position interpolates between adjacent frames, and scanning uses a Q32 phase so that
+   * index and fraction are plain shifts and masks.
+   *
+   * Not used by the bundled units yet, demos/waves and osc/tests/wave keep their own table layouts.
+   * Open limitation: the per-sample cost is not lower than a hand written two row scan as in
+   * osc/tests/wave. On a host build int16_t tables come out ~4% slower and float tables on par,
+   * nothing was measured on the target.
+   *
+   * @tparam T Storage type, float or int16_t.
+   */
+  template <typename T>
+  class Wavetable {
+  public:
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Constructor
+     *
+     * @param data     Table data, e.g. <name>_data from a generated header
+     * @param size_exp Log2 of points per cycle, k_<name>_size_exp
+     * @param levels   Mip levels per frame, k_<name>_levels
+     * @param frames   Number of frames, k_<name>_frames
+     */
+    Wavetable(const T *data, const uint32_t size_exp, const uint32_t levels, const uint32_t frames) :
+      mData(data),
+      mSizeExp(size_exp),
+      mLevels(levels),
+      mFrames(frames),
+      mLevelOffset(0),
+      mMorph(0.f),
+      mMorphZ(0.f)
+    {
+      setW0(440.f / 48000.f);
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Reset phase
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void reset(void)
+    {
+      mPhase.reset();
+    }
+
+    /**
+     * Set phase increment and select the matching mip level
+     *
+     * @param w0 Normalized phase increment in [0, 0.5), e.g. from osc_w0f_for_note()
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setW0(const float w0)
+    {
+      mPhase.setW0(w0);
+      // Highest harmonic of level l is (size/2)>>l, need level >= ceil(log2(size * w0))
+      f32_t s;
+      s.f = w0 * (float)(1U << mSizeExp);
+      const int32_t l = (int32_t)((s.i + 0x7FFFFF) >> 23) - 127;
+      mLevelOffset = clipminmaxi32(0, l, mLevels - 1) * ((1U << mSizeExp) + 1);
+    }
+
+    /**
+     * Set morph position across frames
+     *
+     * @param pos Position in [0, 1], 0 being the first frame and 1 the last.
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setMorph(const float pos)
+    {
+      mMorph = clip01f(pos) * (mFrames - 1);
+    }
+
+    /**
+     * Render one sample at the current morph position
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float process(void)
+    {
+      const uint32_t i = (uint32_t)mMorph;
+      const T *a = frame(i);
+      const T *b = frame(clipmaxu32(i + 1, mFrames - 1));
+      const float y = WavetableSample<T>::kScale * scan(a, b, mPhase.phi, mMorph - i, mSizeExp);
+      mPhase.cycle();
+      mMorphZ = mMorph;
+      return y;
+    }
+
+    /**
+     * Render a block of samples to a Q31 buffer, morph changes are ramped across the block
+     *
+     * @param y      Output buffer
+     * @param frames Number of samples
+     * @param gain   Output gain
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(q31_t * __restrict y, const uint32_t frames, const float gain = 1.f)
+    {
+      // Frame pair is fixed for the block, a ramp coming from another pair starts at its nearest edge
+      const uint32_t i = (uint32_t)mMorph;
+      const T *a = frame(i);
+      const T *b = frame(clipmaxu32(i + 1, mFrames - 1));
+      const float fr_e = mMorph - i;
+      float fr = clip01f(mMorphZ - i);
+      const float fr_inc = (fr_e - fr) / frames;
+      mMorphZ = mMorph;
+
+      // Locals only in the loop, Q31 stores could otherwise alias the uint32_t members
+      const uint32_t size_exp = mSizeExp;
+      const float g = gain * WavetableSample<T>::kScale;
+      uint32_t phi = mPhase.phi;
+      const uint32_t w0 = mPhase.w0;
+      const q31_t * y_e = y + frames;
+      for (; y != y_e; ) {
+        *(y++) = f32_to_q31(g * scan(a, b, phi, fr, size_exp));
+        phi += w0;
+        fr += fr_inc;
+      }
+      mPhase.phi = phi;
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+  private:
+
+    /**
+     * Pointer to the current mip level of a frame
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    const T * frame(const uint32_t i) const
+    {
+      return mData + i * mLevels * ((1U << mSizeExp) + 1) + mLevelOffset;
+    }
+
+    /**
+     * Interpolated lookup in two frames sharing index and fraction, then morph between them
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float scan(const T *a, const T *b, const uint32_t phi, const float morph, const uint32_t size_exp)
+    {
+      const uint32_t x0 = phi >> (32 - size_exp);
+      const typename WavetableSample<T>::frac_t fr = WavetableSample<T>::frac(phi, size_exp);
+      const float ya = WavetableSample<T>::linint(a + x0, fr);
+      const float yb = WavetableSample<T>::linint(b + x0, fr);
+      return linintf(morph, ya, yb);
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    const T  *mData;
+    uint32_t  mSizeExp;
+    uint32_t  mLevels;
+    uint32_t  mFrames;
+    uint32_t  mLevelOffset;
+    PhaseAcc  mPhase;
+    float     mMorph;
+    float     mMorphZ;
+  };
+}
+
+/** @} */
@@ -47,6 +47,7 @@
 #include "float_math.h"
 #include "int_math.h"
 #include "fixed_math.h"
+#include "buffer_ops.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -130,6 +131,87 @@ extern "C" {
     return f * k_samplerate_recipf;
   }
   
+  /** @} */
+
+  /**
+   * @name   Half-period table scan helpers
+   * @note   Branch-free index and sign selection for the half-period tables below, h is 1 in the second half of the period.
+   * @{ 
+   */
+
+  /**
+   * Table indices for a half-period table, reversed in the second half.
+   *
+   * @param   x0p       Index over the full period, in [0, 2*size).
+   * @param   size_exp  Table size exponent.
+   * @param   x0        Output index of the sample at or before the phase.
+   * @param   x1        Output index of the sample after the phase.
+   * @return            Half of the period the index falls in, 0 or 1.
+   */
+  __fast_inline uint32_t _osc_hw_idx(uint32_t x0p, uint32_t size_exp, uint32_t *x0, uint32_t *x1) {
+    const uint32_t h = (x0p >> size_exp) & 1;
+    const uint32_t s = -h; // all ones in second half
+    *x0 = ((x0p ^ s) - s) + ((2U<<size_exp) & s); // x0p, or 2*size - x0p in second half
+    *x1 = *x0 + 1 + (s << 1);
+    return h;
+  }
+
+  /**
+   * Negate y when h is 1, by flipping the sign bit.
+   */
+  __fast_inline float _osc_hw_sign(float y, uint32_t h) {
+    f32_t v = { y };
+    v.i ^= h << 31;
+    return v.f;
+  }
+
+  /**
+   * Render a band-limited half-period wave over a block, crossfading the band index.
+   *
+   * @param   lut       Band tables base, each (1<<size_exp)+1 entries long.
+   * @param   size_exp  Table size exponent.
+   * @param   odd       Non-zero for odd-symmetric waves (negated in second half).
+   * @param   cnt       Number of bands.
+   * @param   y         Q31 output buffer.
+   * @param   frames    Number of samples to render.
+   * @param   phase     Start phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   w0        Phase increment in the same Q32 scale, e.g. dsp::PhaseAcc::w0.
+   * @param   idx0      Fractional band index at start of block.
+   * @param   idx1      Fractional band index at end of block.
+   * @return            Phase after the block.
+   * @note    Table pointers are selected once from the lowest index in the block, if the index moves by
+   *          more than one band within a block the crossfade saturates on the upper band until the next block.
+   * @note    Band-limited waves ring slightly past +/-1 near their edges, the Q31 store saturates.
+   */
+  __fast_inline uint32_t _osc_bl2_block(const float *lut, const uint32_t size_exp, const uint32_t odd, const uint32_t cnt,
+                                        q31_t *y, const uint32_t frames, uint32_t phase, const uint32_t w0,
+                                        const float idx0, const float idx1) {
+    const uint32_t lut_size = (1U<<size_exp) + 1;
+    const uint32_t b = clipmaxu32((uint32_t)((idx0 < idx1) ? idx0 : idx1), cnt - 2);
+    const float *wt0 = lut + b * lut_size;
+    const float *wt1 = wt0 + lut_size;
+    // Full period spans 2*size table points, the remaining low bits are the fraction
+    const uint32_t shift = 31 - size_exp;
+    const uint32_t mask = (1U<<shift) - 1;
+    const float frrecip = 1.f / (float)(1U<<shift);
+    
+    float fr = idx0 - b;
+    const float fr_inc = (idx1 - idx0) / frames;
+    
+    const q31_t *y_e = y + frames;
+    for (; y != y_e; ) {
+      uint32_t x0, x1;
+      const uint32_t h = _osc_hw_idx(phase >> shift, size_exp, &x0, &x1);
+      const float xfr = frrecip * (float)(phase & mask);
+      const float sig = linintf(clip01f(fr), linintf(xfr, wt0[x0], wt0[x1]), linintf(xfr, wt1[x0], wt1[x1]));
+      *(y++) = f32_to_q31_sat((odd) ? _osc_hw_sign(sig, h) : sig);
+      
+      phase += w0;
+      fr += fr_inc;
+    }
+    return phase;
+  }
+
   /** @} */
   
   /**
@@ -164,7 +246,7 @@ extern "C" {
     const uint32_t x1 = (x0 + 1) & k_wt_sine_mask;
     
     const float y0 = linintf(x0f - x0p, wt_sine_lut_f[x0], wt_sine_lut_f[x1]);
-    return (x0p < k_wt_sine_size)?y0:-y0;
+    return _osc_hw_sign(y0, (x0p >> k_wt_sine_size_exp) & 1);
   }
     
   /**
@@ -176,6 +258,31 @@ extern "C" {
   __fast_inline float osc_cosf(float x) {
     return osc_sinf(x+0.25f);
   }
+
+  /**
+   * Lookup value of sin(2*pi*x), Q32 phase version.
+   *
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
+   * @return     Result of sin(2*pi*x).
+   */
+  __fast_inline float osc_sinuf(uint32_t x) {
+    const uint32_t x0p = x >> k_wt_sine_u32shift;
+    const uint32_t x0 = x0p & k_wt_sine_mask;
+    const uint32_t x1 = (x0 + 1) & k_wt_sine_mask;
+    const float fr = k_wt_sine_frrecip * (float)(x & ((1U<<k_wt_sine_u32shift)-1));
+    const float y0 = linintf(fr, wt_sine_lut_f[x0], wt_sine_lut_f[x1]);
+    return _osc_hw_sign(y0, x0p >> k_wt_sine_size_exp);
+  }
+
+  /**
+   * Lookup value of cos(2*pi*x), Q32 phase version.
+   *
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
+   * @return     Result of cos(2*pi*x).
+   */
+  __fast_inline float osc_cosuf(uint32_t x) {
+    return osc_sinuf(x + (1U<<30));
+  }
   
   /** @} */
   
@@ -197,8 +304,6 @@ extern "C" {
   extern const uint8_t wt_saw_notes[k_wt_saw_notes_cnt];
   extern const float wt_saw_lut_f[k_wt_saw_lut_tsize];
 
-  //TODO: add integer phase versions
-  
   /**
    * Sawtooth wave lookup.
    *
@@ -211,16 +316,25 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_saw_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    uint32_t x0 = x0p, x1 = x0p+1;
-    float sign = 1.f;
-    if (x0p >= k_wt_saw_size) {
-      x0 = k_wt_saw_size - (x0p & k_wt_saw_mask);
-      x1 = x0 - 1;
-      sign = -1.f;
-    }
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x0p, k_wt_saw_size_exp, &x0, &x1);
     
     const float y0 = linintf(x0f - x0p, wt_saw_lut_f[x0], wt_saw_lut_f[x1]);
-    return sign*y0;
+    return _osc_hw_sign(y0, h);
+  }
+
+  /**
+   * Sawtooth wave lookup, Q32 phase version.
+   *
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
+   * @return     Wave sample.
+   */
+  __fast_inline float osc_sawuf(uint32_t x) {
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x >> k_wt_saw_u32shift, k_wt_saw_size_exp, &x0, &x1);
+    const float fr = k_wt_saw_frrecip * (float)(x & ((1U<<k_wt_saw_u32shift)-1));
+    const float y0 = linintf(fr, wt_saw_lut_f[x0], wt_saw_lut_f[x1]);
+    return _osc_hw_sign(y0, h);
   }
   
   /**
@@ -236,16 +350,28 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_saw_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    uint32_t x0 = x0p, x1 = x0p+1;
-    float sign = 1.f;
-    if (x0p >= k_wt_saw_size) {
-      x0 = k_wt_saw_size - (x0p & k_wt_saw_mask);
-      x1 = x0 - 1;
-      sign = -1.f;
-    }
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x0p, k_wt_saw_size_exp, &x0, &x1);
+    
     const float *wt = &wt_saw_lut_f[idx*k_wt_saw_lut_size];
     const float y0 = linintf(x0f - x0p, wt[x0], wt[x1]);
-    return sign*y0;
+    return _osc_hw_sign(y0, h);
+  }
+
+  /**
+   * Band-limited sawtooth wave lookup, Q32 phase version.
+   *
+   * @param   x     Phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   idx   Wave index in [0,6].
+   * @return        Wave sample.
+   */
+  __fast_inline float osc_bl_sawuf(uint32_t x, uint8_t idx) {
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x >> k_wt_saw_u32shift, k_wt_saw_size_exp, &x0, &x1);
+    const float fr = k_wt_saw_frrecip * (float)(x & ((1U<<k_wt_saw_u32shift)-1));
+    const float *wt = &wt_saw_lut_f[idx*k_wt_saw_lut_size];
+    const float y0 = linintf(fr, wt[x0], wt[x1]);
+    return _osc_hw_sign(y0, h);
   }
 
   /**
@@ -261,21 +387,37 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_saw_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    uint32_t x0 = x0p, x1 = x0p+1;
-    float sign = 1.f;
-    if (x0p >= k_wt_saw_size) {
-      x0 = k_wt_saw_size - (x0p & k_wt_saw_mask);
-      x1 = x0 - 1;
-      sign = -1.f;
-    }
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x0p, k_wt_saw_size_exp, &x0, &x1);
+    
     const float *wt = &wt_saw_lut_f[(uint16_t)idx*k_wt_saw_lut_size];
     const float fr = x0f - x0p;
-    const float y0 = sign * linintf(fr, wt[x0], wt[x1]);
+    const float y0 = linintf(fr, wt[x0], wt[x1]);
 
     wt += k_wt_saw_lut_size;
-    const float y1 = sign * linintf(fr, wt[x0], wt[x1]);
+    const float y1 = linintf(fr, wt[x0], wt[x1]);
     
-    return linintf((idx - (uint8_t)idx), y0, y1);
+    return _osc_hw_sign(linintf((idx - (uint8_t)idx), y0, y1), h);
+  }
+
+  /**
+   * Band-limited sawtooth wave lookup, Q32 phase version. (interpolated version)
+   *
+   * @param   x     Phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   idx   Fractional wave index in [0,6].
+   * @return        Wave sample.
+   */
+  __fast_inline float osc_bl2_sawuf(uint32_t x, float idx) {
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x >> k_wt_saw_u32shift, k_wt_saw_size_exp, &x0, &x1);
+    const float fr = k_wt_saw_frrecip * (float)(x & ((1U<<k_wt_saw_u32shift)-1));
+    const float *wt = &wt_saw_lut_f[(uint16_t)idx*k_wt_saw_lut_size];
+    const float y0 = linintf(fr, wt[x0], wt[x1]);
+
+    wt += k_wt_saw_lut_size;
+    const float y1 = linintf(fr, wt[x0], wt[x1]);
+    
+    return _osc_hw_sign(linintf((idx - (uint8_t)idx), y0, y1), h);
   } 
 
   /**
@@ -289,6 +431,23 @@ extern "C" {
   __fast_inline float osc_bl_saw_idx(float note) {
     return _osc_bl_saw_idx(note);
   }
+
+  /**
+   * Band-limited sawtooth wave over a block, straight to Q31, Q32 phase version. (interpolated version)
+   *
+   * @param   y       Q31 output buffer.
+   * @param   frames  Number of samples.
+   * @param   phase   Start phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   w0      Phase increment in the same Q32 scale, e.g. dsp::PhaseAcc::w0.
+   * @param   idx0    Fractional wave index in [0,6] at start of block, typically the previous block's idx1.
+   * @param   idx1    Fractional wave index in [0,6] at end of block, from osc_bl_saw_idx() once per block.
+   * @return          Phase after the block.
+   */
+  __fast_inline uint32_t osc_bl2_sawuf_block(q31_t *y, const uint32_t frames, const uint32_t phase, const uint32_t w0,
+                                             const float idx0, const float idx1) {
+    return _osc_bl2_block(wt_saw_lut_f, k_wt_saw_size_exp, 1, k_wt_saw_notes_cnt, y, frames, phase, w0, idx0, idx1);
+  }
+
   
   
   /** @} */
@@ -324,16 +483,25 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_sqr_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    uint32_t x0 = x0p, x1 = x0p+1;
-    float sign = 1.f;
-    if (x0p >= k_wt_sqr_size) {
-      x0 = k_wt_sqr_size - (x0p & k_wt_sqr_mask);
-      x1 = x0 - 1;
-      sign = -1.f;
-    }
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x0p, k_wt_sqr_size_exp, &x0, &x1);
     
     const float y0 = linintf(x0f - x0p, wt_sqr_lut_f[x0], wt_sqr_lut_f[x1]);
-    return sign*y0;
+    return _osc_hw_sign(y0, h);
+  }
+
+  /**
+   * Square wave lookup, Q32 phase version.
+   *
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
+   * @return     Wave sample.
+   */
+  __fast_inline float osc_sqruf(uint32_t x) {
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x >> k_wt_sqr_u32shift, k_wt_sqr_size_exp, &x0, &x1);
+    const float fr = k_wt_sqr_frrecip * (float)(x & ((1U<<k_wt_sqr_u32shift)-1));
+    const float y0 = linintf(fr, wt_sqr_lut_f[x0], wt_sqr_lut_f[x1]);
+    return _osc_hw_sign(y0, h);
   }
 
   /**
@@ -350,16 +518,28 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_sqr_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    uint32_t x0 = x0p, x1 = x0p+1;
-    float sign = 1.f;
-    if (x0p >= k_wt_sqr_size) {
-      x0 = k_wt_sqr_size - (x0p & k_wt_sqr_mask);
-      x1 = x0 - 1;
-      sign = -1.f;
-    }
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x0p, k_wt_sqr_size_exp, &x0, &x1);
+    
     const float *wt = &wt_sqr_lut_f[idx*k_wt_sqr_lut_size];
     const float y0 = linintf(x0f - x0p, wt[x0], wt[x1]);
-    return sign*y0;
+    return _osc_hw_sign(y0, h);
+  }
+
+  /**
+   * Band-limited square wave lookup, Q32 phase version.
+   *
+   * @param   x     Phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   idx   Wave index in [0,6].
+   * @return        Wave sample.
+   */
+  __fast_inline float osc_bl_sqruf(uint32_t x, uint8_t idx) {
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x >> k_wt_sqr_u32shift, k_wt_sqr_size_exp, &x0, &x1);
+    const float fr = k_wt_sqr_frrecip * (float)(x & ((1U<<k_wt_sqr_u32shift)-1));
+    const float *wt = &wt_sqr_lut_f[idx*k_wt_sqr_lut_size];
+    const float y0 = linintf(fr, wt[x0], wt[x1]);
+    return _osc_hw_sign(y0, h);
   }
 
   /**
@@ -376,21 +556,37 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_sqr_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    uint32_t x0 = x0p, x1 = x0p+1;
-    float sign = 1.f;
-    if (x0p >= k_wt_sqr_size) {
-      x0 = k_wt_sqr_size - (x0p & k_wt_sqr_mask);
-      x1 = x0 - 1;
-      sign = -1.f;
-    }
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x0p, k_wt_sqr_size_exp, &x0, &x1);
+    
     const float *wt = &wt_sqr_lut_f[(uint16_t)idx*k_wt_sqr_lut_size];
     const float fr = x0f - x0p;
-    const float y0 = sign * linintf(fr, wt[x0], wt[x1]);
+    const float y0 = linintf(fr, wt[x0], wt[x1]);
 
     wt += k_wt_sqr_lut_size;
-    const float y1 = sign * linintf(fr, wt[x0], wt[x1]);
+    const float y1 = linintf(fr, wt[x0], wt[x1]);
     
-    return linintf((idx - (uint8_t)idx), y0, y1);
+    return _osc_hw_sign(linintf((idx - (uint8_t)idx), y0, y1), h);
+  }
+
+  /**
+   * Band-limited square wave lookup, Q32 phase version. (interpolated version)
+   *
+   * @param   x     Phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   idx   Fractional wave index in [0,6].
+   * @return        Wave sample.
+   */
+  __fast_inline float osc_bl2_sqruf(uint32_t x, float idx) {
+    uint32_t x0, x1;
+    const uint32_t h = _osc_hw_idx(x >> k_wt_sqr_u32shift, k_wt_sqr_size_exp, &x0, &x1);
+    const float fr = k_wt_sqr_frrecip * (float)(x & ((1U<<k_wt_sqr_u32shift)-1));
+    const float *wt = &wt_sqr_lut_f[(uint16_t)idx*k_wt_sqr_lut_size];
+    const float y0 = linintf(fr, wt[x0], wt[x1]);
+
+    wt += k_wt_sqr_lut_size;
+    const float y1 = linintf(fr, wt[x0], wt[x1]);
+    
+    return _osc_hw_sign(linintf((idx - (uint8_t)idx), y0, y1), h);
   }
   
   /**
@@ -404,6 +600,23 @@ extern "C" {
   __fast_inline float osc_bl_sqr_idx(float note) {
     return _osc_bl_sqr_idx(note);
   }
+
+  /**
+   * Band-limited square wave over a block, straight to Q31, Q32 phase version. (interpolated version)
+   *
+   * @param   y       Q31 output buffer.
+   * @param   frames  Number of samples.
+   * @param   phase   Start phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   w0      Phase increment in the same Q32 scale, e.g. dsp::PhaseAcc::w0.
+   * @param   idx0    Fractional wave index in [0,6] at start of block, typically the previous block's idx1.
+   * @param   idx1    Fractional wave index in [0,6] at end of block, from osc_bl_sqr_idx() once per block.
+   * @return          Phase after the block.
+   */
+  __fast_inline uint32_t osc_bl2_sqruf_block(q31_t *y, const uint32_t frames, const uint32_t phase, const uint32_t w0,
+                                             const float idx0, const float idx1) {
+    return _osc_bl2_block(wt_sqr_lut_f, k_wt_sqr_size_exp, 1, k_wt_sqr_notes_cnt, y, frames, phase, w0, idx0, idx1);
+  }
+
   
   /** @} */
 
@@ -439,10 +652,23 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_par_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    const uint32_t x0 = (x0p<=k_wt_par_size) ? x0p : (k_wt_par_size - (x0p & k_wt_par_mask));
-    const uint32_t x1 = (x0p<(k_wt_par_size-1)) ? (x0 + 1) & k_wt_par_mask : (x0p >= k_wt_par_size) ? (x0 - 1) & k_wt_par_mask : (x0 + 1);
-    const float y0 = linintf(x0f - x0p, wt_par_lut_f[x0], wt_par_lut_f[x1]);
-    return y0;
+    uint32_t x0, x1;
+    _osc_hw_idx(x0p, k_wt_par_size_exp, &x0, &x1);
+    
+    return linintf(x0f - x0p, wt_par_lut_f[x0], wt_par_lut_f[x1]);
+  }
+
+  /**
+   * Parabolic wave lookup, Q32 phase version.
+   *
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
+   * @return     Wave sample.
+   */
+  __fast_inline float osc_paruf(uint32_t x) {
+    uint32_t x0, x1;
+    _osc_hw_idx(x >> k_wt_par_u32shift, k_wt_par_size_exp, &x0, &x1);
+    const float fr = k_wt_par_frrecip * (float)(x & ((1U<<k_wt_par_u32shift)-1));
+    return linintf(fr, wt_par_lut_f[x0], wt_par_lut_f[x1]);
   }
   
   /**
@@ -459,12 +685,26 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_par_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    const uint32_t x0 = (x0p<=k_wt_par_size) ? x0p : (k_wt_par_size - (x0p & k_wt_par_mask));
-    const uint32_t x1 = (x0p<(k_wt_par_size-1)) ? (x0 + 1) & k_wt_par_mask : (x0p >= k_wt_par_size) ? (x0 - 1) & k_wt_par_mask : (x0 + 1);
+    uint32_t x0, x1;
+    _osc_hw_idx(x0p, k_wt_par_size_exp, &x0, &x1);
 
     const float *wt = &wt_par_lut_f[idx*k_wt_par_lut_size];
-    const float y0 = linintf(x0f - x0p, wt[x0], wt[x1]);
-    return y0;
+    return linintf(x0f - x0p, wt[x0], wt[x1]);
+  }
+
+  /**
+   * Band-limited parabolic wave lookup, Q32 phase version.
+   *
+   * @param   x     Phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   idx   Wave index in [0,6].
+   * @return        Wave sample.
+   */
+  __fast_inline float osc_bl_paruf(uint32_t x, uint8_t idx) {
+    uint32_t x0, x1;
+    _osc_hw_idx(x >> k_wt_par_u32shift, k_wt_par_size_exp, &x0, &x1);
+    const float fr = k_wt_par_frrecip * (float)(x & ((1U<<k_wt_par_u32shift)-1));
+    const float *wt = &wt_par_lut_f[idx*k_wt_par_lut_size];
+    return linintf(fr, wt[x0], wt[x1]);
   }
 
   /**
@@ -481,8 +721,8 @@ extern "C" {
     const float x0f = 2.f * p * k_wt_par_size;
     const uint32_t x0p = (uint32_t)x0f;
     
-    uint32_t x0 = (x0p<=k_wt_par_size) ? x0p : (k_wt_par_size - (x0p & k_wt_par_mask));
-    uint32_t x1 = (x0p<(k_wt_par_size-1)) ? (x0 + 1) & k_wt_par_mask : (x0p >= k_wt_par_size) ? (x0 - 1) & k_wt_par_mask : (x0 + 1);
+    uint32_t x0, x1;
+    _osc_hw_idx(x0p, k_wt_par_size_exp, &x0, &x1);
 
     const float *wt = &wt_par_lut_f[(uint16_t)idx*k_wt_par_lut_size];
     const float fr = x0f - x0p;
@@ -494,6 +734,26 @@ extern "C" {
 
     return linintf((idx - (uint8_t)idx), y0, y1);
   }
+
+  /**
+   * Band-limited parabolic wave lookup, Q32 phase version. (interpolated version)
+   *
+   * @param   x     Phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   idx   Fractional wave index in [0,6].
+   * @return        Wave sample.
+   */
+  __fast_inline float osc_bl2_paruf(uint32_t x, float idx) {
+    uint32_t x0, x1;
+    _osc_hw_idx(x >> k_wt_par_u32shift, k_wt_par_size_exp, &x0, &x1);
+    const float fr = k_wt_par_frrecip * (float)(x & ((1U<<k_wt_par_u32shift)-1));
+    const float *wt = &wt_par_lut_f[(uint16_t)idx*k_wt_par_lut_size];
+    const float y0 = linintf(fr, wt[x0], wt[x1]);
+
+    wt += k_wt_par_lut_size;
+    const float y1 = linintf(fr, wt[x0], wt[x1]);
+
+    return linintf((idx - (uint8_t)idx), y0, y1);
+  }
   
   /**
    * Get band-limited parabolic wave index for note.
@@ -506,6 +766,22 @@ extern "C" {
   __fast_inline float osc_bl_par_idx(float note) {
     return _osc_bl_par_idx(note);
   }
+
+  /**
+   * Band-limited parabolic wave over a block, straight to Q31, Q32 phase version. (interpolated version)
+   *
+   * @param   y       Q31 output buffer.
+   * @param   frames  Number of samples.
+   * @param   phase   Start phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   w0      Phase increment in the same Q32 scale, e.g. dsp::PhaseAcc::w0.
+   * @param   idx0    Fractional wave index in [0,6] at start of block, typically the previous block's idx1.
+   * @param   idx1    Fractional wave index in [0,6] at end of block, from osc_bl_par_idx() once per block.
+   * @return          Phase after the block.
+   */
+  __fast_inline uint32_t osc_bl2_paruf_block(q31_t *y, const uint32_t frames, const uint32_t phase, const uint32_t w0,
+                                             const float idx0, const float idx1) {
+    return _osc_bl2_block(wt_par_lut_f, k_wt_par_size_exp, 0, k_wt_par_notes_cnt, y, frames, phase, w0, idx0, idx1);
+  }
   
   /** @} */
   
@@ -522,8 +798,8 @@ extern "C" {
 
 #define k_waves_size_exp   (7)
 #define k_waves_size       (1U<<k_waves_size_exp)
-#define k_waves_u32shift   (24)
-#define k_waves_frrecip    (5.96046447753906e-008f) // 1/(1<<24)
+#define k_waves_u32shift   (32 - k_waves_size_exp)
+#define k_waves_frrecip    (2.98023223876953e-008f) // 1/(1<<25)
 #define k_waves_mask       (k_waves_size-1)
 #define k_waves_lut_size   (k_waves_size+1)
   
@@ -688,8 +964,8 @@ extern "C" {
    * @return     Cubic curve above 0.42264973081, gain: 1.2383127573
    */
   __fast_inline float osc_sat_cubicf(float x) {
-    const float xf = si_fabsf(clip1f(x)) * k_cubicsat_size;
-    const uint32_t xi = (uint32_t)x;
+    const float xf = si_fabsf(clip1m1f(x)) * k_cubicsat_size;
+    const uint32_t xi = clipmaxu32((uint32_t)xf, k_cubicsat_size - 1);
     const float y0 = cubicsat_lut_f[xi];
     const float y1 = cubicsat_lut_f[xi+1];
     return si_copysignf(linintf(xf - xi, y0, y1), x);
@@ -709,8 +985,8 @@ extern "C" {
    * @return     Saturated value.
    */
   __fast_inline float osc_sat_schetzenf(float x) {
-    const float xf = si_fabsf(clip1f(x)) * k_schetzen_size;
-    const uint32_t xi = (uint32_t)x;
+    const float xf = si_fabsf(clip1m1f(x)) * k_schetzen_size;
+    const uint32_t xi = clipmaxu32((uint32_t)xf, k_schetzen_size - 1);
     const float y0 = schetzen_lut_f[xi];
     const float y1 = schetzen_lut_f[xi+1];
     return si_copysignf(linintf(xf - xi, y0, y1), x);
@@ -52,6 +52,16 @@
 
 #define REP4(expr) (expr);(expr);(expr);(expr);
 
+/*
+ * Cortex-M4 paths use LDM/STM multi-word transfers and VCVT fixed-point
+ * conversions (r7 is kept out of register lists as it is the Thumb frame
+ * pointer). Generic paths are written so that host compilers can
+ * auto-vectorize them (SSE2/AVX2/NEON) at -Ofast.
+ */
+#if defined(__ARM_ARCH_7EM__)
+#define BUFFER_OPS_CM4
+#endif
+
 /**
  * @name    Buffer format conversion
  * @{
@@ -91,6 +101,188 @@ void buf_f32_to_q31(const float *flt,
   }
 }
 
+/** Saturating float to Q31 conversion
+ * @note Uses VCVT to Q31 fixed-point on Cortex-M4, which saturates and costs a single instruction.
+ *       Elsewhere the upper bound is 1-2^-24, as (float)0x7FFFFFFF rounds to 2^31 and +1 would wrap to INT_MIN.
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+q31_t f32_to_q31_sat(float f)
+{
+#if defined(BUFFER_OPS_CM4)
+  __asm__ ("vcvt.s32.f32 %0, %0, #31" : "+t" (f));
+  f32_t r = {f};
+  return (q31_t)r.i;
+#else
+  return f32_to_q31(clipminmaxf(-1.f, f, 0.99999994f));
+#endif
+}
+
+/** Buffer-wise saturating float to Q31 conversion
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+void buf_f32_to_q31_sat(const float *flt,
+                        q31_t * __restrict__ q31,
+                        const size_t len)
+{
+  const float *end = flt + ((len>>2)<<2);
+  for (; flt != end; ) {
+    REP4(*(q31++) = f32_to_q31_sat(*(flt++)));
+  }
+  end += len & 0x3;
+  for (; flt != end; ) {
+    *(q31++) = f32_to_q31_sat(*(flt++));
+  }
+}
+
+//** @} */
+
+/**
+ * @name    Stereo interleaving
+ * @{
+ */
+
+/** Interleave two mono buffers into a stereo buffer (LRLR...)
+ *
+ * @param l   Left channel samples
+ * @param r   Right channel samples
+ * @param dst Interleaved output, 2*len samples
+ * @param len Number of frames
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+void buf_interleave_f32(const float *l,
+                        const float *r,
+                        float * __restrict__ dst,
+                        const size_t len)
+{
+  const float *end = l + ((len>>2)<<2);
+  for (; l != end; ) {
+    REP4((*(dst++) = *(l++), *(dst++) = *(r++)));
+  }
+  end += len & 0x3;
+  for (; l != end; ) {
+    *(dst++) = *(l++);
+    *(dst++) = *(r++);
+  }
+}
+
+/** Deinterleave a stereo buffer (LRLR...) into two mono buffers
+ *
+ * @param src Interleaved input, 2*len samples
+ * @param l   Left channel output
+ * @param r   Right channel output
+ * @param len Number of frames
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+void buf_deinterleave_f32(const float *src,
+                          float * __restrict__ l,
+                          float * __restrict__ r,
+                          const size_t len)
+{
+  const float *end = l + ((len>>2)<<2);
+  for (; l != end; ) {
+    REP4((*(l++) = *(src++), *(r++) = *(src++)));
+  }
+  end += len & 0x3;
+  for (; l != end; ) {
+    *(l++) = *(src++);
+    *(r++) = *(src++);
+  }
+}
+
+//** @} */
+
+/**
+ * @name    Gain and mixing
+ * @note    In-place operation is allowed when src == dst.
+ * @{
+ */
+
+/** Scale buffer by constant gain: dst = g * src
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+void buf_scale_f32(const float *src,
+                   float *dst,
+                   const float g,
+                   const size_t len)
+{
+  const float *end = src + ((len>>2)<<2);
+  for (; src != end; ) {
+    REP4(*(dst++) = g * *(src++));
+  }
+  end += len & 0x3;
+  for (; src != end; ) {
+    *(dst++) = g * *(src++);
+  }
+}
+
+/** Mix-accumulate buffer into destination: dst += g * src
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+void buf_mixacc_f32(const float *src,
+                    float * __restrict__ dst,
+                    const float g,
+                    const size_t len)
+{
+  const float *end = src + ((len>>2)<<2);
+  for (; src != end; ) {
+    REP4(*(dst++) += g * *(src++));
+  }
+  end += len & 0x3;
+  for (; src != end; ) {
+    *(dst++) += g * *(src++);
+  }
+}
+
+/** Dry/wet crossfade: dst = dry + mix * (wet - dry)
+ *
+ * @param dry Dry signal
+ * @param wet Wet signal
+ * @param dst Output, may alias dry or wet
+ * @param mix Wet amount in [0, 1]
+ * @param len Number of samples
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+void buf_xfade_f32(const float *dry,
+                   const float *wet,
+                   float *dst,
+                   const float mix,
+                   const size_t len)
+{
+  const float *end = dry + ((len>>2)<<2);
+  for (; dry != end; ) {
+    REP4(*(dst++) = linintf(mix, *(dry++), *(wet++)));
+  }
+  end += len & 0x3;
+  for (; dry != end; ) {
+    *(dst++) = linintf(mix, *(dry++), *(wet++));
+  }
+}
+
+/** Dry/wet crossfade with linear mix ramp, avoids zipper noise on parameter changes
+ *
+ * @param dry  Dry signal
+ * @param wet  Wet signal
+ * @param dst  Output, may alias dry or wet
+ * @param mix0 Wet amount at start of buffer
+ * @param mix1 Wet amount at end of buffer
+ * @param len  Number of samples
+ */
+static inline __attribute__((optimize("Ofast"),always_inline))
+void buf_xfade_ramp_f32(const float *dry,
+                        const float *wet,
+                        float *dst,
+                        const float mix0,
+                        const float mix1,
+                        const size_t len)
+{
+  const float inc = (mix1 - mix0) / len;
+  float mix = mix0;
+  const float *end = dry + len;
+  for (; dry != end; mix += inc) {
+    *(dst++) = linintf(mix, *(dry++), *(wet++));
+  }
+}
+
 //** @} */
 
 /**
@@ -105,9 +297,25 @@ void buf_clr_f32(float * __restrict__ ptr,
                  const uint32_t len)
 {
   const float *end = ptr + ((len>>2)<<2);
+#if defined(BUFFER_OPS_CM4)
+  if (ptr != end) {
+    __asm__ volatile ("mov r4, #0\n\t"
+                      "mov r5, #0\n\t"
+                      "mov r6, #0\n\t"
+                      "mov r8, #0\n"
+                      "1:\n\t"
+                      "stmia %[p]!, {r4-r6, r8}\n\t"
+                      "cmp %[p], %[e]\n\t"
+                      "bne 1b"
+                      : [p] "+r" (ptr)
+                      : [e] "r" (end)
+                      : "r4", "r5", "r6", "r8", "cc", "memory");
+  }
+#else
   for (; ptr != end; ) {
     REP4(*(ptr++) = 0);
   }
+#endif
   end += len & 0x3;
   for (; ptr != end; ) {
     *(ptr++) = 0;
@@ -121,9 +329,25 @@ void buf_clr_u32(uint32_t * __restrict__ ptr,
                  const size_t len)
 {
   const uint32_t *end = ptr + ((len>>2)<<2);
+#if defined(BUFFER_OPS_CM4)
+  if (ptr != end) {
+    __asm__ volatile ("mov r4, #0\n\t"
+                      "mov r5, #0\n\t"
+                      "mov r6, #0\n\t"
+                      "mov r8, #0\n"
+                      "1:\n\t"
+                      "stmia %[p]!, {r4-r6, r8}\n\t"
+                      "cmp %[p], %[e]\n\t"
+                      "bne 1b"
+                      : [p] "+r" (ptr)
+                      : [e] "r" (end)
+                      : "r4", "r5", "r6", "r8", "cc", "memory");
+  }
+#else
   for (; ptr != end; ) {
     REP4(*(ptr++) = 0);
   }
+#endif
   end += len & 0x3;
   for (; ptr != end; ) {
     *(ptr++) = 0;
@@ -145,9 +369,22 @@ void buf_cpy_f32(const float *src,
                  const size_t len)
 {
   const float *end = src + ((len>>2)<<2);
+#if defined(BUFFER_OPS_CM4)
+  if (src != end) {
+    __asm__ volatile ("1:\n\t"
+                      "ldmia %[s]!, {r4-r6, r8}\n\t"
+                      "stmia %[d]!, {r4-r6, r8}\n\t"
+                      "cmp %[s], %[e]\n\t"
+                      "bne 1b"
+                      : [s] "+r" (src), [d] "+r" (dst)
+                      : [e] "r" (end)
+                      : "r4", "r5", "r6", "r8", "cc", "memory");
+  }
+#else
   for (; src != end; ) {
     REP4(*(dst++) = *(src++));
   }
+#endif
   end += len & 0x3;
   for (; src != end; ) {
     *(dst++) = *(src++);
@@ -162,9 +399,22 @@ void buf_cpy_u32(const uint32_t *src,
                  const size_t len)
 {
   const uint32_t *end = src + ((len>>2)<<2);
+#if defined(BUFFER_OPS_CM4)
+  if (src != end) {
+    __asm__ volatile ("1:\n\t"
+                      "ldmia %[s]!, {r4-r6, r8}\n\t"
+                      "stmia %[d]!, {r4-r6, r8}\n\t"
+                      "cmp %[s], %[e]\n\t"
+                      "bne 1b"
+                      : [s] "+r" (src), [d] "+r" (dst)
+                      : [e] "r" (end)
+                      : "r4", "r5", "r6", "r8", "cc", "memory");
+  }
+#else
   for (; src != end; ) {
     REP4(*(dst++) = *(src++));
   }
+#endif
   end += len & 0x3;
   for (; src != end; ) {
     *(dst++) = *(src++);
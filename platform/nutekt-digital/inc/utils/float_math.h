@@ -49,6 +49,7 @@
 
 #include <math.h>
 #include <stdint.h>
+#include <stddef.h>
 
 /*===========================================================================*/
 /* Constants.                                                                */
@@ -678,8 +679,9 @@ float fasterlogf(float x) {
 static inline __attribute__((optimize("Ofast"), always_inline))
 float fastpow2f(float p) {
   float clipp = (p < -126) ? -126.0f : p;
+  float offset = (p < 0) ? 1.0f : 0.0f;
   int w = clipp;
-  float z = clipp - w + 1.f;
+  float z = clipp - w + offset;
   union { uint32_t i; float f; } v = { (uint32_t) ( (1 << 23) * 
       (clipp + 121.2740575f + 27.7280233f / (4.84252568f - z) - 1.49012907f * z)
       ) };
@@ -699,7 +701,6 @@ float fasterpow2f(float p) {
 
 /** "Fast" x to the power of p approximation
  * @note Adapted from Paul Mineiro's FastFloat
- * @note Warning: Seems to have divergent segments with discontinuities for some base/exponent combinations
  */
 static inline __attribute__((optimize("Ofast"), always_inline))
 float fastpowf(float x, float p) {
@@ -767,37 +768,346 @@ float fastertanhf(float x) {
 
 /** @} */
 
+/*===========================================================================*/
+/* Polynomial Approximation Tiers.                                           */
+/*===========================================================================*/
+
+/**
+ * @name    Polynomial approximation tiers
+ * @note    Minimax polynomials of increasing order, the _oN suffix selects the accuracy/speed tradeoff.
+ * @note    Errors measured in float against double precision libm over the valid domain (sine/cosine over [-pi, pi], range reduction adds ~|x|*6e-8),
+ *          speedups measured on x86-64 against libm in a 4096 sample loop. Cortex-M4 figures will differ, the orders keep their relative cost.
+ * @note    pow2 errors are for a given float p, rounding p itself to float adds ~|p|*4e-8 rel., e.g. ~8e-7 in total for pow2f_o5 at |p| = 16.
+ * @note    Coefficients are fit with tools/minimax/minimax.py, errors and speedups are reproduced by tools/mathcheck.
+ *
+ *  function     | order | max error     | vs libm
+ *  -------------|-------|---------------|--------
+ *  pow2f_o2     | 2     | 1.7e-3 rel.   | ~8x
+ *  pow2f_o3     | 3     | 7.5e-5 rel.   | ~7x
+ *  pow2f_o5     | 5     | 1.8e-7 rel.   | ~5x
+ *  log2f_o3     | 3     | 1.3e-3 abs.   | ~9x
+ *  log2f_o4     | 4     | 1.8e-4 abs.   | ~6x
+ *  log2f_o6     | 6     | 4.2e-6 abs.   | ~5x
+ *  sinf_o3      | 3     | 4.5e-3 abs.   | ~5x
+ *  sinf_o5      | 5     | 6.8e-5 abs.   | ~4x
+ *  sinf_o7      | 7     | 7.7e-7 abs.   | ~4x
+ *
+ * @{
+ */
+
+/** Split p in [-126, ... into integer exponent w and fractional part in [0, 1]
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float __pow2f_frac(const float p, int32_t *w) {
+  const float clipp = (p < -126.f) ? -126.f : p;
+  *w = (int32_t)clipp - (clipp < 0.f);
+  return clipp - (float)*w;
+}
+
+/** Scale polynomial result y by 2^w by adding w to the exponent bits
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float __pow2f_scale(const float y, const int32_t w) {
+  union { float f; int32_t i; } v = { y };
+  v.i += w << 23;
+  return v.f;
+}
+
+/** Power of 2 approximation, 2nd order minimax, valid for p in [-126, ...
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float pow2f_o2(const float p) {
+  int32_t w;
+  const float f = __pow2f_frac(p, &w);
+  return __pow2f_scale(1.00172476f + f * (0.657636276f + f * 0.337189435f), w);
+}
+
+/** Power of 2 approximation, 3rd order minimax, valid for p in [-126, ...
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float pow2f_o3(const float p) {
+  int32_t w;
+  const float f = __pow2f_frac(p, &w);
+  return __pow2f_scale(0.999925219f + f * (0.695833541f + f * (0.226067155f + f * 0.0780245227f)), w);
+}
+
+/** Power of 2 approximation, 5th order minimax, valid for p in [-126, ...
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float pow2f_o5(const float p) {
+  int32_t w;
+  const float f = __pow2f_frac(p, &w);
+  return __pow2f_scale(0.999999925f + f * (0.693153073f + f * (0.240153617f + f * (0.0558263181f + f * (0.00898934009f + f * 0.00187757667f)))), w);
+}
+
+/** Split positive x into integer exponent e and m - 1, with mantissa m in [sqrt(1/2), sqrt(2))
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float __log2f_frac(const float x, int32_t *e) {
+  union { float f; int32_t i; } vx = { x };
+  *e = (vx.i - 0x3f3504f3) >> 23;
+  vx.i -= *e << 23;
+  return vx.f - 1.f;
+}
+
+/** Log base 2 approximation, 3rd order minimax, valid for positive x
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float log2f_o3(const float x) {
+  int32_t e;
+  const float t = __log2f_frac(x, &e);
+  return (float)e + t * (1.44417705f + t * (-0.75113473f + t * 0.449609689f));
+}
+
+/** Log base 2 approximation, 4th order minimax, valid for positive x
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float log2f_o4(const float x) {
+  int32_t e;
+  const float t = __log2f_frac(x, &e);
+  return (float)e + t * (1.44227043f + t * (-0.724296953f + t * (0.51127274f + t * -0.327770771f)));
+}
+
+/** Log base 2 approximation, 6th order minimax, valid for positive x
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float log2f_o6(const float x) {
+  int32_t e;
+  const float t = __log2f_frac(x, &e);
+  return (float)e + t * (1.44270162f + t * (-0.72120639f + t * (0.479811855f + t * (-0.366491705f + t * (0.31819991f + t * -0.206191054f)))));
+}
+
+/** Reduce x in radians to a phase in cycles folded into [-0.25, 0.25]
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float __sinf_fold(const float x) {
+  float t = x * M_1_TWOPI;
+  t -= si_roundf(t);
+  return si_copysignf(0.25f - si_fabsf(0.25f - si_fabsf(t)), t);
+}
+
+/** Sine approximation, 3rd order minimax, valid for x in radians as precision allows
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float sinf_o3(const float x) {
+  const float t = __sinf_fold(x);
+  const float t2 = t * t;
+  return t * (6.19226474f + t2 * -35.3637069f);
+}
+
+/** Sine approximation, 5th order minimax, valid for x in radians as precision allows
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float sinf_o5(const float x) {
+  const float t = __sinf_fold(x);
+  const float t2 = t * t;
+  return t * (6.28128008f + t2 * (-41.0952427f + t2 * 73.5855148f));
+}
+
+/** Sine approximation, 7th order minimax, valid for x in radians as precision allows
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float sinf_o7(const float x) {
+  const float t = __sinf_fold(x);
+  const float t2 = t * t;
+  return t * (6.28316404f + t2 * (-41.3371424f + t2 * (81.3407689f + t2 * -70.9934333f)));
+}
+
+/** Cosine approximation, 3rd order minimax, valid for x in radians as precision allows
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float cosf_o3(const float x) {
+  return sinf_o3(x + M_PI_2);
+}
+
+/** Cosine approximation, 5th order minimax, valid for x in radians as precision allows
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float cosf_o5(const float x) {
+  return sinf_o5(x + M_PI_2);
+}
+
+/** Cosine approximation, 7th order minimax, valid for x in radians as precision allows
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float cosf_o7(const float x) {
+  return sinf_o7(x + M_PI_2);
+}
+
+/** Exponential approximation, 3rd order minimax, valid for x in [~ -87, ...
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float expf_o3(const float x) {
+  return pow2f_o3(M_LOG2E * x);
+}
+
+/** Exponential approximation, 5th order minimax, valid for x in [~ -87, ...
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float expf_o5(const float x) {
+  return pow2f_o5(M_LOG2E * x);
+}
+
+/** x to the power of p approximation, 4th order log2 and 3rd order pow2, valid for positive x
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float powf_o3(const float x, const float p) {
+  return pow2f_o3(p * log2f_o4(x));
+}
+
+/** x to the power of p approximation, 6th order log2 and 5th order pow2, valid for positive x
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float powf_o5(const float x, const float p) {
+  return pow2f_o5(p * log2f_o6(x));
+}
+
+/** @} */
+
+/*===========================================================================*/
+/* Block Approximations.                                                     */
+/*===========================================================================*/
+
+/**
+ * @name    Block approximations
+ * @note    Buffer-wise versions of the approximations above, in-place operation (x == y) is allowed.
+ * @note    Unrolled by 4 to keep the Cortex-M4 FPU busy between dependent operations, and simple enough for host compilers to vectorize.
+ * @note    Errors measured against double precision libm over the valid domain. Speedups are x86-64 host figures against per-sample libm calls
+ *          over 64 sample blocks, as printed by tools/mathcheck, and only indicate relative cost. They do not carry over to the Cortex-M4.
+ * @{
+ */
+
+#define __f32_block_unary(fn, x, y, len) {                  \
+    const float *end = (x) + ((len) & ~(size_t)0x3);          \
+    for (; (x) != end; (x) += 4, (y) += 4) {                \
+      const float x0 = (x)[0], x1 = (x)[1];                 \
+      const float x2 = (x)[2], x3 = (x)[3];                 \
+      (y)[0] = fn(x0); (y)[1] = fn(x1);                     \
+      (y)[2] = fn(x2); (y)[3] = fn(x3);                     \
+    }                                                       \
+    end += (len) & 0x3;                                     \
+    for (; (x) != end; ) {                                  \
+      *((y)++) = fn(*((x)++));                              \
+    }                                                       \
+  }
+
+/** "Fast" power of 2 approximation over a buffer, valid for x in [-126, ...
+ * @note max rel. error 6.0e-5, ~3.5x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fastpow2f_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fastpow2f, x, y, len);
+}
+
+/** "Faster" power of 2 approximation over a buffer, valid for x in [-126, ...
+ * @note max rel. error 3.9e-2, ~9x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fasterpow2f_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fasterpow2f, x, y, len);
+}
+
+/** "Fast" exponential approximation over a buffer, valid for x in [~ -87, ...
+ * @note max rel. error 6.0e-5, ~3x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fastexpf_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fastexpf, x, y, len);
+}
+
+/** "Faster" exponential approximation over a buffer, valid for x in [~ -87, ...
+ * @note max rel. error 3.9e-2, ~7.5x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fasterexpf_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fasterexpf, x, y, len);
+}
+
+/** "Fast" log base 2 approximation over a buffer, valid for positive x
+ * @note max abs. error 1.7e-4, ~7x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fastlog2f_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fastlog2f, x, y, len);
+}
+
+/** "Faster" log base 2 approximation over a buffer, valid for positive x
+ * @note max abs. error 5.7e-2, ~12x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fasterlog2f_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fasterlog2f, x, y, len);
+}
+
+/** "Fast" sine approximation over a buffer, valid for full x domain
+ * @note max abs. error 4.3e-5, ~3x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fastsinfullf_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fastsinfullf, x, y, len);
+}
+
+/** "Faster" sine approximation over a buffer, valid for full x domain
+ * @note max abs. error 8.9e-4, ~5.5x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fastersinfullf_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(fastersinfullf, x, y, len);
+}
+
+/** fastertanhf() is only fit for x >= 0, extend it oddly
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+float __fastertanhf_odd(const float x) {
+  return si_copysignf(fastertanhf(si_fabsf(x)), x);
+}
+
+/** Hyperbolic tangent approximation over a buffer, valid for x in [-3, 3], tends to +/-1.17 beyond
+ * @note max abs. error 2.8e-5, ~15x libm on host
+ */
+static inline __attribute__((optimize("Ofast"), always_inline))
+void fastertanhf_block(const float *x, float *y, const size_t len) {
+  __f32_block_unary(__fastertanhf_odd, x, y, len);
+}
+
+/** @} */
+
 /*===========================================================================*/
 /* Useful Conversions.                                                       */
 /*===========================================================================*/
 
 /**
  * @name    Useful Conversions
- * @note    These can be very slow, use with caution. Should use table lookups in performance critical sections.
+ * @note    Some of these can be very slow, use with caution. Should use table lookups in performance critical sections.
  * @{
  */
 
 /** Amplitude to dB 
  * @note Will remove low boundary check in future version
+ * @note 4th order log2 approximation, max abs. error 1.1e-3 dB
+ * @note Returns -999 for amp <= 0, log2f_o4() has no -inf. Accurate down to the smallest normal float (~-759 dB), below that ~-765 dB.
  */
 static inline __attribute__((optimize("Ofast"), always_inline))
 float ampdbf(const float amp) {
-  return (amp < 0.f) ? -999.f : 20.f*log10f(amp);
+  static const float c = 6.020599913279624f; // 20.f / log2f(10);
+  return (amp <= 0.f) ? -999.f : c*log2f_o4(amp);
 }
 
 /** "Faster" Amplitude to dB
  */
 static inline __attribute__((optimize("Ofast"), always_inline))
 float fasterampdbf(const float amp) {
-  static const float c = 3.3219280948873626f; // 20.f / log2f(10);
+  static const float c = 6.020599913279624f; // 20.f / log2f(10);
   return c*fasterlog2f(amp);
 }
 
 /** dB to ampltitude
+ * @note 3rd order pow2 approximation, max rel. error 7.5e-5 (6.5e-4 dB)
  */
 static inline __attribute__((optimize("Ofast"), always_inline))
 float dbampf(const float db) {
-  return powf(10.f,0.05f*db);
+  static const float c = 0.16609640474436813f; // log2f(10) / 20.f;
+  return pow2f_o3(c*db);
 }
 
 /** "Faster" dB to ampltitude
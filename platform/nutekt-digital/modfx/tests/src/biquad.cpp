@@ -12,9 +12,9 @@
 #include "usermodfx.h"
 
 #include "biquad.hpp"
+#include "fxbus.hpp"
 
-static dsp::BiQuad s_bq_l, s_bq_r;
-static dsp::BiQuad s_bqs_l, s_bqs_r;
+static dsp::FxBus<dsp::BiQuad> s_bus;
 
 enum {
   k_polelp = 0,
@@ -42,28 +42,20 @@ void MODFX_INIT(uint32_t platform, uint32_t api)
   s_q = 1.4041f;
   s_type = s_type_z = k_polelp;
 
-  s_bq_l.flush();
-  s_bq_r.flush();
-  s_bq_l.mCoeffs.setPoleLP(s_wc);
-  s_bq_r.mCoeffs = s_bq_l.mCoeffs;
-
-  s_bqs_l.flush();
-  s_bqs_r.flush();
-  s_bqs_l.mCoeffs = s_bqs_r.mCoeffs = s_bq_l.mCoeffs;
+  s_bus.setPlatform(platform);
 
+  dsp::BiQuad::Coeffs c;
+  c.setPoleLP(s_wc);
+  for (uint32_t i = 0; i < s_bus.kLanes; ++i) {
+    s_bus.lane(i).flush();
+    s_bus.lane(i).mCoeffs = c;
+  }
 }
 
 void MODFX_PROCESS(const float *main_xn, float *main_yn,
                    const float *sub_xn,  float *sub_yn,
                    uint32_t frames)
 {
-  const float * mx = main_xn;
-  float * __restrict my = main_yn;
-  const float * my_e = my + 2*frames;
-
-  const float *sx = sub_xn;
-  float * __restrict sy = sub_yn;
-  
   const uint8_t type = s_type;
   const float wc = s_wc;
   
@@ -71,69 +63,64 @@ void MODFX_PROCESS(const float *main_xn, float *main_yn,
       || wc != s_wc_z) {
     
     // type changed
+    dsp::BiQuad::Coeffs &c = s_bus.lane(0).mCoeffs;
     switch (type) {
     case k_polelp:
-      s_bq_l.mCoeffs.setPoleLP(1.f - (wc*2.f));
+      c.setPoleLP(1.f - (wc*2.f));
       break;
       
     case k_polehp:
-      s_bq_l.mCoeffs.setPoleHP(wc*2.f);
+      c.setPoleHP(wc*2.f);
       break;
       
     case k_folp:
-      s_bq_l.mCoeffs.setFOLP(fx_tanpif(wc));
+      c.setFOLP(fx_tanpif(wc));
       break;
       
     case k_fohp:
-      s_bq_l.mCoeffs.setFOHP(fx_tanpif(wc));
+      c.setFOHP(fx_tanpif(wc));
       break;
       
     case k_foap:
-      s_bq_l.mCoeffs.setFOAP(fx_tanpif(wc));
+      c.setFOAP(fx_tanpif(wc));
       break;
 
     case k_foap2:
-      s_bq_l.mCoeffs.setFOAP2(wc);
+      c.setFOAP2(wc);
       break;
 
     case k_solp:
-      s_bq_l.mCoeffs.setSOLP(fx_tanpif(wc), s_q);
+      c.setSOLP(fx_tanpif(wc), s_q);
       break;
 
     case k_sohp:
-      s_bq_l.mCoeffs.setSOHP(fx_tanpif(wc), s_q);
+      c.setSOHP(fx_tanpif(wc), s_q);
       break;
 
     case k_sobp:
-      s_bq_l.mCoeffs.setSOBP(fx_tanpif(wc), s_q);
+      c.setSOBP(fx_tanpif(wc), s_q);
       break;
 
     case k_sobr:
-      s_bq_l.mCoeffs.setSOBR(fx_tanpif(wc), s_q);
+      c.setSOBR(fx_tanpif(wc), s_q);
       break;
 
     case k_soap1:
-      s_bq_l.mCoeffs.setSOAP1(fx_tanpif(wc), s_q);
+      c.setSOAP1(fx_tanpif(wc), s_q);
       break;
       
     default:
       break;
     }
 
-    s_bq_r.mCoeffs = s_bq_l.mCoeffs;
-    s_bqs_l.mCoeffs = s_bq_l.mCoeffs;
-    s_bqs_r.mCoeffs = s_bq_l.mCoeffs;
+    for (uint32_t i = 1; i < s_bus.kLanes; ++i)
+      s_bus.lane(i).mCoeffs = c;
     
     s_type_z = type;
     s_wc_z = wc;
   }
   
-  for (; my != my_e; ) {
-    *(my++) = s_bq_l.process_so(*(mx++));
-    *(my++) = s_bq_r.process_so(*(mx++));
-    *(sy++) = s_bqs_l.process_so(*(sx++));
-    *(sy++) = s_bqs_r.process_so(*(sx++));
-  }
+  s_bus.process_block(main_xn, main_yn, sub_xn, sub_yn, frames);
 }
 
 
@@ -0,0 +1,557 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    adaa.hpp
+ * @brief   Antiderivative anti-aliasing for static nonlinearities.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+#include "int_math.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /*===========================================================================*/
+  /* Shapes.                                                                   */
+  /*===========================================================================*/
+
+  /**
+   * Shapes provide the nonlinearity f() and its antiderivatives F1() and F2(), second order is optional.
+   * Antiderivatives are chosen so that they are continuous, and smooth enough that their approximation
+   * error does not get amplified by the divided differences in ADAA1/ADAA2.
+   */
+
+  /**
+   * Cubic soft clip, same curve as osc_softclipf()/fx_softclipf(): x - c * x^3 after clipping to [-1, 1]
+   */
+  struct ShapeSoftClip {
+
+    ShapeSoftClip(void) : mC(1.f / 3.f) { }
+
+    /**
+     * @param c Cubic coefficient, in [0, 1/3] for a monotonic curve, 1/3 being the smoothest knee
+     */
+    inline void setCoeff(const float c)
+    {
+      mC = c;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float f(float x) const
+    {
+      x = clip1m1f(x);
+      return x - mC * (x*x*x);
+    }
+
+    /** Even: x^2/2 - c*x^4/4 inside, linear with slope 1-c outside */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F1(const float x) const
+    {
+      const float a = si_fabsf(x);
+      const float a1 = clipmaxf(a, 1.f);
+      const float a2 = a1 * a1;
+      return a2 * (0.5f - 0.25f * mC * a2) + (1.f - mC) * (a - a1);
+    }
+
+    /** Odd: x^3/6 - c*x^5/20 inside, quadratic outside */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F2(const float x) const
+    {
+      const float a = si_fabsf(x);
+      const float a1 = clipmaxf(a, 1.f);
+      const float a2 = a1 * a1;
+      const float u = a - a1;
+      return si_copysignf(a2 * a1 * (0.16666667f - 0.05f * mC * a2) + u * (0.5f - 0.25f * mC + 0.5f * (1.f - mC) * u), x);
+    }
+
+    float mC;
+  };
+
+  /**
+   * Hyperbolic tangent, first order only
+   *
+   * F1 is log(cosh(x)) computed as |x| - log(2) + log(1 + exp(-2|x|)), with a single polynomial for the
+   * log term so that there are no range reduction seams in F1. f() matches it to float precision and unlike
+   * fastertanhf() is valid over the whole real line.
+   */
+  struct ShapeTanh {
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float f(const float x) const
+    {
+      const float e = expm2abs(x);
+      return si_copysignf((1.f - e) / (1.f + e), x);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F1(const float x) const
+    {
+      const float e = expm2abs(x);
+      // log(1 + e) / e on [0, 1], 7th order Chebyshev fit, 1.2e-7 max abs error
+      const float l = e * (0.999999781f + e * (-0.499971745f + e * (0.332719284f + e * (-0.244747742f +
+                      e * (0.176874767f + e * (-0.106850029f + e * (0.0434938998f + e * -0.00837115255f)))))));
+      return si_fabsf(x) - M_LN2 + l;
+    }
+
+  private:
+
+    /** exp(-2|x|), flushed to zero well before pow2 range ends */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float expm2abs(const float x)
+    {
+      return pow2f_o5(clipminf(-126.f, -2.f * M_LOG2E * si_fabsf(x)));
+    }
+  };
+
+  /**
+   * Odd symmetric shaper defined by a 129 point table over [0, 1], e.g. cubicsat_lut_f or schetzen_lut_f,
+   * clipped outside [-1, 1] as osc_sat_cubicf()/osc_sat_schetzenf(). First order only.
+   *
+   * F1 of the linearly interpolated curve is exact, from a running sum of the table built by init().
+   */
+  struct ShapeLut {
+
+    static constexpr uint32_t kSizeExp = 7;
+    static constexpr uint32_t kSize = 1U << kSizeExp;
+
+    ShapeLut(void) : mLut(0) { }
+
+    /**
+     * Bind table and integrate it, must be called before processing
+     *
+     * @param lut Table of kSize+1 points, f(i/kSize) for i in [0, kSize]
+     */
+    inline void init(const float *lut)
+    {
+      mLut = lut;
+      mInt[0] = 0.f;
+      for (uint32_t i = 0; i < kSize; ++i)
+        mInt[i+1] = mInt[i] + (0.5f / kSize) * (lut[i] + lut[i+1]);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float f(const float x) const
+    {
+      const float xf = si_fabsf(clip1m1f(x)) * kSize;
+      const uint32_t xi = clipmaxu32((uint32_t)xf, kSize - 1);
+      return si_copysignf(linintf(xf - xi, mLut[xi], mLut[xi+1]), x);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F1(const float x) const
+    {
+      const float a = si_fabsf(x);
+      const float xf = clipmaxf(a, 1.f) * kSize;
+      const uint32_t xi = clipmaxu32((uint32_t)xf, kSize - 1);
+      const float t = xf - xi;
+      const float y0 = mLut[xi];
+      const float y1 = mLut[xi+1];
+      return mInt[xi] + (1.f / kSize) * t * (y0 + 0.5f * t * (y1 - y0)) + mLut[kSize] * clipminf(0.f, a - 1.f);
+    }
+
+    const float *mLut;
+    float mInt[kSize + 1];
+  };
+
+  /**
+   * Sine wavefolder, sin(2*pi*x), with polynomial sine and cosine so that antiderivatives are smooth
+   */
+  struct ShapeSineFold {
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float f(const float x) const
+    {
+      return sinf_o7(M_TWOPI * x);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F1(const float x) const
+    {
+      return -M_1_TWOPI * cosf_o7(M_TWOPI * x);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F2(const float x) const
+    {
+      return -(M_1_TWOPI * M_1_TWOPI) * sinf_o7(M_TWOPI * x);
+    }
+  };
+
+  /**
+   * Periodic shaper with period 1 from a 129 point half period table with odd half-wave symmetry,
+   * f(x + 1/2) = -f(x), e.g. wt_sine_lut_f for the same fold curve as osc_sinf().
+   *
+   * Cheaper than ShapeSineFold. F1 and F2 are exact for the interpolated curve, from running sums built
+   * by init(), so the divided differences stay consistent with f().
+   */
+  struct ShapeWaveLut {
+
+    static constexpr uint32_t kSizeExp = 7;
+    static constexpr uint32_t kSize = 1U << kSizeExp;
+    /** Table step in periods */
+    static constexpr float kStep = 0.5f / kSize;
+
+    ShapeWaveLut(void) : mLut(0) { }
+
+    /**
+     * Bind table and integrate it twice, must be called before processing
+     *
+     * @param lut Table of kSize+1 points over half a period
+     */
+    inline void init(const float *lut)
+    {
+      mLut = lut;
+      mInt1[0] = mInt2[0] = 0.f;
+      for (uint32_t i = 0; i < kSize; ++i) {
+        mInt2[i+1] = mInt2[i] + kStep * (mInt1[i] + kStep * (lut[i] * (1.f / 3.f) + lut[i+1] * (1.f / 6.f)));
+        mInt1[i+1] = mInt1[i] + (0.5f * kStep) * (lut[i] + lut[i+1]);
+      }
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float f(const float x) const
+    {
+      float n, t;
+      uint32_t half, xi;
+      locate(x, n, half, xi, t);
+      const float y = linintf(t, mLut[xi], mLut[xi+1]);
+      return half ? -y : y;
+    }
+
+    /** Periodic, rises over the first half period and falls back over the second */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F1(const float x) const
+    {
+      float n, t;
+      uint32_t half, xi;
+      locate(x, n, half, xi, t);
+      const float g = seg1(xi, t);
+      return half ? mInt1[kSize] - g : g;
+    }
+
+    /** Grows by mInt1[kSize] / 2 per period, F1 having a non zero mean */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float F2(const float x) const
+    {
+      float n, t;
+      uint32_t half, xi;
+      locate(x, n, half, xi, t);
+      const float a = mInt1[kSize];
+      const float k = seg2(xi, t);
+      const float g = half ? mInt2[kSize] + a * kStep * (xi + t) - k : k;
+      return n * (0.5f * a) + g;
+    }
+
+  private:
+
+    /** Split x into whole periods n, half period, segment index and fraction */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void locate(const float x, float &n, uint32_t &half, uint32_t &xi, float &t)
+    {
+      // si_floorf() only handles positive values
+      const float q = (float)(int32_t)x;
+      n = (q > x) ? q - 1.f : q;
+      const float p = (x - n) * (2 * kSize);
+      const uint32_t pi = clipmaxu32((uint32_t)p, 2 * kSize - 1);
+      half = pi >> kSizeExp;
+      xi = pi & (kSize - 1);
+      t = p - pi;
+    }
+
+    /** First half period F1 within segment xi */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float seg1(const uint32_t xi, const float t) const
+    {
+      const float y0 = mLut[xi];
+      return mInt1[xi] + kStep * t * (y0 + 0.5f * t * (mLut[xi+1] - y0));
+    }
+
+    /** First half period F2 within segment xi */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float seg2(const uint32_t xi, const float t) const
+    {
+      const float y0 = mLut[xi];
+      return mInt2[xi] + kStep * t * (mInt1[xi] + kStep * t * (0.5f * y0 + (1.f / 6.f) * t * (mLut[xi+1] - y0)));
+    }
+
+    const float *mLut;
+    float mInt1[kSize + 1];
+    float mInt2[kSize + 1];
+  };
+
+  /*===========================================================================*/
+  /* Processors.                                                               */
+  /*===========================================================================*/
+
+  /**
+   * First order antiderivative anti-aliasing, y = (F1(x[n]) - F1(x[n-1])) / (x[n] - x[n-1])
+   *
+   * Adds half a sample of latency and a gentle high frequency rolloff (-3.9dB at Nyquist), falls back
+   * to f() at the midpoint when consecutive inputs are too close for the division to be well conditioned.
+   *
+   * @tparam Shape One of the Shape* structs above, or any type providing f() and F1().
+   */
+  template <typename Shape>
+  class ADAA1 {
+  public:
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    /** Input step below which the midpoint fallback is used */
+    static constexpr float kTolerance = 1e-3f;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Constructor, state is zeroed without evaluating the shape, call reset() once the shape is set up
+     */
+    ADAA1(void) : mX1(0.f), mF1(0.f) { }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Shape parameters, call resync() after changing them
+     */
+    inline Shape & shape(void)
+    {
+      return mShape;
+    }
+
+    /**
+     * Clear state to a constant input
+     */
+    inline void reset(const float x = 0.f)
+    {
+      mX1 = x;
+      mF1 = mShape.F1(x);
+    }
+
+    /**
+     * Recompute the cached antiderivative after a shape parameter change
+     */
+    inline void resync(void)
+    {
+      mF1 = mShape.F1(mX1);
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float process(const float x)
+    {
+      return step(mShape, x, mX1, mF1);
+    }
+
+    /**
+     * Process a block, x and y may be the same buffer
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(const float *x, float *y, const uint32_t frames)
+    {
+      float x1 = mX1;
+      float F1 = mF1;
+      const float * x_e = x + frames;
+      for (; x != x_e; ) {
+        *(y++) = step(mShape, *(x++), x1, F1);
+      }
+      mX1 = x1;
+      mF1 = F1;
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+  private:
+
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float step(const Shape &s, const float x, float &x1, float &F1)
+    {
+      const float F = s.F1(x);
+      const float d = x - x1;
+      const float y = (si_fabsf(d) < kTolerance) ? s.f(0.5f * (x + x1)) : (F - F1) / d;
+      x1 = x;
+      F1 = F;
+      return y;
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    Shape mShape;
+    float mX1;
+    float mF1;
+  };
+
+  /**
+   * Second order antiderivative anti-aliasing
+   *
+   * y = 2 / (x[n] - x[n-2]) * (D[n] - D[n-1]), with D[n] = (F2(x[n]) - F2(x[n-1])) / (x[n] - x[n-1]).
+   * One sample of latency, stronger alias suppression and rolloff than ADAA1, roughly twice the cost.
+   * The looser tolerance accounts for the double division amplifying float rounding in F2.
+   *
+   * @tparam Shape Shape providing f(), F1() and F2().
+   */
+  template <typename Shape>
+  class ADAA2 {
+  public:
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    /** Input step below which the divided differences fall back to lower order */
+    static constexpr float kTolerance = 1e-2f;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Constructor, state is zeroed without evaluating the shape, call reset() once the shape is set up
+     */
+    ADAA2(void) : mX1(0.f), mX2(0.f), mF2(0.f), mD1(0.f) { }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Shape parameters, call resync() after changing them
+     */
+    inline Shape & shape(void)
+    {
+      return mShape;
+    }
+
+    /**
+     * Clear state to a constant input
+     */
+    inline void reset(const float x = 0.f)
+    {
+      mX1 = mX2 = x;
+      mF2 = mShape.F2(x);
+      mD1 = mShape.F1(x);
+    }
+
+    /**
+     * Recompute the cached antiderivatives after a shape parameter change
+     */
+    inline void resync(void)
+    {
+      const float d = mX1 - mX2;
+      mF2 = mShape.F2(mX1);
+      mD1 = (si_fabsf(d) < kTolerance) ? mShape.F1(0.5f * (mX1 + mX2)) : (mF2 - mShape.F2(mX2)) / d;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float process(const float x)
+    {
+      return step(mShape, x, mX1, mX2, mF2, mD1);
+    }
+
+    /**
+     * Process a block, x and y may be the same buffer
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(const float *x, float *y, const uint32_t frames)
+    {
+      float x1 = mX1, x2 = mX2, F2 = mF2, D1 = mD1;
+      const float * x_e = x + frames;
+      for (; x != x_e; ) {
+        *(y++) = step(mShape, *(x++), x1, x2, F2, D1);
+      }
+      mX1 = x1;
+      mX2 = x2;
+      mF2 = F2;
+      mD1 = D1;
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+  private:
+
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float step(const Shape &s, const float x, float &x1, float &x2, float &F2, float &D1)
+    {
+      const float F = s.F2(x);
+      const float d01 = x - x1;
+      const float D = (si_fabsf(d01) < kTolerance) ? s.F1(0.5f * (x + x1)) : (F - F2) / d01;
+      const float d02 = x - x2;
+      float y;
+      if (si_fabsf(d02) < kTolerance) {
+        // x[n] ~ x[n-2], expand around their mean instead
+        const float xb = 0.5f * (x + x2);
+        const float delta = xb - x1;
+        y = (si_fabsf(delta) < kTolerance) ? s.f(0.5f * (xb + x1))
+          : (2.f / delta) * (s.F1(xb) + (F2 - s.F2(xb)) / delta);
+      }
+      else {
+        y = 2.f * (D - D1) / d02;
+      }
+      x2 = x1;
+      x1 = x;
+      F2 = F;
+      D1 = D;
+      return y;
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    Shape mShape;
+    float mX1;
+    float mX2;
+    float mF2;
+    float mD1;
+  };
+}
+
+/** @} */
@@ -0,0 +1,190 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    fxbus.hpp
+ * @brief   Main and sub bus processing for modulation effects.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "userprg.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * Whether the modfx sub bus carries audio on a platform. Only the prologue feeds its second timbre through it,
+   * the minilogue xd and Nu:Tekt NTS-1 pass buffers that are neither heard nor need to be written.
+   * Units run unchanged on every compatible platform, so this is checked at runtime.
+   *
+   * @param platform Platform passed to MODFX_INIT().
+   */
+  static inline bool fxHasSubBus(const uint32_t platform)
+  {
+    return (platform & USER_TARGET_PLATFORM_MASK) == k_user_target_prologue;
+  }
+
+  /**
+   * One processor per channel for the modfx main and sub buses, run in a single pass over the block.
+   *
+   * Lanes are main L, main R, sub L and sub R. All four are allocated, the sub lanes are only processed once
+   * setPlatform() reports a sub bus, elsewhere the sub buffers are neither read nor written. Lane state is copied
+   * to locals for the duration of the block so that output stores cannot force reloads of coefficients.
+   *
+   * @tparam Lane Per channel processor providing float process(float), e.g. BiQuad.
+   */
+  template <typename Lane>
+  class FxBus {
+  public:
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    /** Number of channels, main and sub */
+    static constexpr uint32_t kLanes = 4;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Default constructor, assumes the build target platform until setPlatform() is called
+     */
+    FxBus(void) :
+      mSubBus(fxHasSubBus(USER_TARGET_PLATFORM))
+    { }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Select the lanes to process from the platform the unit runs on
+     *
+     * @param platform Platform passed to MODFX_INIT().
+     */
+    inline void setPlatform(const uint32_t platform)
+    {
+      mSubBus = fxHasSubBus(platform);
+    }
+
+    /**
+     * Whether the sub lanes are processed
+     */
+    inline bool hasSubBus(void) const
+    {
+      return mSubBus;
+    }
+
+    /**
+     * Access a lane, e.g. to set parameters on each one
+     *
+     * @param i Lane index in [0, kLanes)
+     */
+    inline Lane & lane(const uint32_t i)
+    {
+      return mLanes[i];
+    }
+
+    /**
+     * Process interleaved stereo main and sub buffers as passed to MODFX_PROCESS(), can be done in place
+     *
+     * @param main_x Main input, 2*frames samples
+     * @param main_y Main output, 2*frames samples
+     * @param sub_x  Sub input, 2*frames samples
+     * @param sub_y  Sub output, 2*frames samples
+     * @param frames Number of stereo frames
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(const float *main_x, float *main_y,
+                       const float *sub_x, float *sub_y,
+                       const uint32_t frames)
+    {
+      // Branch once per block, each variant keeps its lanes in locals
+      if (mSubBus)
+        process_lanes<true>(main_x, main_y, sub_x, sub_y, frames);
+      else
+        process_lanes<false>(main_x, main_y, sub_x, sub_y, frames);
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+  private:
+
+    template <bool Sub>
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_lanes(const float *main_x, float *main_y,
+                       const float *sub_x, float *sub_y,
+                       const uint32_t frames)
+    {
+      const uint32_t lanes = Sub ? 4 : 2;
+      Lane l[lanes];
+      for (uint32_t i = 0; i < lanes; ++i)
+        l[i] = mLanes[i];
+
+      const float * mx_e = main_x + 2 * frames;
+      for (; main_x != mx_e; main_x += 2, main_y += 2) {
+        main_y[0] = l[0].process(main_x[0]);
+        main_y[1] = l[1].process(main_x[1]);
+        if (Sub) {
+          sub_y[0] = l[lanes - 2].process(sub_x[0]);
+          sub_y[1] = l[lanes - 1].process(sub_x[1]);
+          sub_x += 2;
+          sub_y += 2;
+        }
+      }
+
+      for (uint32_t i = 0; i < lanes; ++i)
+        mLanes[i] = l[i];
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    Lane mLanes[kLanes];
+    bool mSubBus;
+  };
+}
+
+/** @} */
@@ -0,0 +1,276 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    karplusstrong.hpp
+ * @brief   Karplus-Strong plucked string engine.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+#include "int_math.h"
+#include "fixed_math.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * Karplus-Strong string loop: delay line, first order Thiran allpass for the fractional part of the
+   * period, linear phase 3-tap loop filter and a soft clip on the single feedback path.
+   *
+   * The loop filter has a constant one sample delay at all frequencies so that tuning compensation is
+   * exact, its damping only shortens the decay of upper partials. Decay time is set independently of pitch.
+   * reset() is O(1): samples written before it are masked out by a fill counter instead of being cleared.
+   */
+  class KarplusStrong {
+  public:
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    /** Soft clip coefficient, same curve as osc_softclipf(0.05f, x) */
+    static constexpr float kClipCoeff = 0.05f;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    KarplusStrong(void) :
+      mLine(0),
+      mMask(0),
+      mWrite(0),
+      mFill(0),
+      mLength(0),
+      mEta(0.f),
+      mApX1(0.f),
+      mApY1(0.f),
+      mF1(0.f),
+      mF2(0.f),
+      mTap(0.f),
+      mGain(1.f),
+      mPeriod(2.f),
+      mDecay(48000.f)
+    { }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Set the memory area to use as delay line
+     *
+     * @param ram       Pointer to memory buffer
+     * @param line_size Size in float of memory buffer, must be a power of 2
+     */
+    inline void setMemory(float *ram, const uint32_t line_size)
+    {
+      mLine = ram;
+      mMask = line_size - 1;
+      reset();
+    }
+
+    /**
+     * Silence the string in constant time
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void reset(void)
+    {
+      mFill = 0;
+      mApX1 = mApY1 = 0.f;
+      mF1 = mF2 = 0.f;
+    }
+
+    /**
+     * Set pitch
+     *
+     * @param w0 Normalized frequency in (0, 0.4], periods longer than the line are clipped
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setW0(const float w0)
+    {
+      // Loop delay is line + allpass + loop filter = N + d + 1, keep d in [0.5, 1.5) for a flat allpass delay
+      const float period = clipminmaxf(2.5f, 1.f / w0, (float)mMask);
+      const uint32_t n = (uint32_t)(period - 1.5f);
+      const float d = period - 1.f - n;
+      mLength = n;
+      mEta = (1.f - d) / (1.f + d);
+      mPeriod = period;
+      updateGain();
+    }
+
+    /**
+     * Set high frequency damping
+     *
+     * @param damping In [0, 1], 0 for a lossless loop filter, 1 for a null at Nyquist
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setDamping(const float damping)
+    {
+      mTap = 0.25f * clip01f(damping);
+    }
+
+    /**
+     * Set decay time
+     *
+     * @param t60 Time to decay by 60dB, in samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setDecay(const float t60)
+    {
+      mDecay = t60;
+      updateGain();
+    }
+
+    /**
+     * Run one sample
+     *
+     * @param x Excitation added to the loop
+     * @return  Output sample
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float process(const float x)
+    {
+      State st;
+      load(st);
+      const float y = step(st, x);
+      store(st);
+      return y;
+    }
+
+    /**
+     * Run a block without excitation
+     *
+     * @param y      Output buffer
+     * @param frames Number of samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void process_block(q31_t * __restrict y, const uint32_t frames)
+    {
+      // Locals only in the loop, Q31 stores could otherwise alias the uint32_t members
+      State st;
+      load(st);
+      const q31_t * y_e = y + frames;
+      for (; y != y_e; ) {
+        *(y++) = f32_to_q31(step(st, 0.f));
+      }
+      store(st);
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+  private:
+
+    /** Per sample state, kept in registers across a block */
+    struct State {
+      float *line;
+      uint32_t mask, write, fill, length;
+      float eta, ap_x1, ap_y1, f1, f2, tap, gain;
+    };
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void load(State &st) const
+    {
+      st.line = mLine; st.mask = mMask; st.write = mWrite; st.fill = mFill; st.length = mLength;
+      st.eta = mEta; st.ap_x1 = mApX1; st.ap_y1 = mApY1; st.f1 = mF1; st.f2 = mF2; st.tap = mTap; st.gain = mGain;
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void store(const State &st)
+    {
+      mWrite = st.write; mFill = st.fill;
+      mApX1 = st.ap_x1; mApY1 = st.ap_y1; mF1 = st.f1; mF2 = st.f2;
+    }
+
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float step(State &st, const float x)
+    {
+      // Anything older than the last reset reads as silence
+      const float v = (st.length <= st.fill) ? st.line[(st.write - st.length) & st.mask] : 0.f;
+
+      const float ap = st.eta * (v - st.ap_y1) + st.ap_x1;
+      st.ap_x1 = v;
+      st.ap_y1 = ap;
+
+      const float f = st.tap * (ap + st.f2) + (1.f - 2.f * st.tap) * st.f1;
+      st.f2 = st.f1;
+      st.f1 = ap;
+
+      float s = clip1m1f(st.gain * f + x);
+      s = s - kClipCoeff * (s*s*s);
+
+      st.line[st.write & st.mask] = s;
+      ++st.write;
+      st.fill = clipmaxu32(st.fill + 1, st.mask);
+      return s;
+    }
+
+    /** Loop gain per period for the requested decay time */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void updateGain(void)
+    {
+      // 10^(-3 * period / t60)
+      mGain = pow2f_o3(-3.f * M_LN10 * M_LOG2E * mPeriod / clipminf(1.f, mDecay));
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    float    *mLine;
+    uint32_t  mMask;
+    uint32_t  mWrite;
+    uint32_t  mFill;
+    uint32_t  mLength;
+    float     mEta;
+    float     mApX1;
+    float     mApY1;
+    float     mF1;
+    float     mF2;
+    float     mTap;
+    float     mGain;
+    float     mPeriod;
+    float     mDecay;
+  };
+}
+
+/** @} */
@@ -0,0 +1,257 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    lut.hpp
+ * @brief   Compile-time lookup table generation.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "float_math.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * Constexpr math used to evaluate table contents at compile time.
+   * @note Evaluated in double precision, C++11 single-return constexpr style. Not meant for runtime use.
+   */
+  namespace cx {
+
+    constexpr double kPi = 3.14159265358979323846;
+    constexpr double kLn2 = 0.69314718055994530942;
+
+    constexpr double abs(double x) { return (x < 0) ? -x : x; }
+    constexpr double sq(double x) { return x * x; }
+    constexpr double clip(double lo, double x, double hi) { return (x < lo) ? lo : (x > hi) ? hi : x; }
+
+    /** Round to nearest integer, as double */
+    constexpr double round(double x) { return (double)(long long)(x + ((x < 0) ? -0.5 : 0.5)); }
+
+    /** Taylor series of sin(x) from term k onwards, term = x^(2k+1)/(2k+1)! with alternating sign */
+    constexpr double sin_series(double x2, double term, int k) {
+      return (k > 13) ? 0.0 : term + sin_series(x2, -term * x2 / ((2 * k + 2) * (2 * k + 3)), k + 1);
+    }
+
+    /** Sine, x in radians */
+    constexpr double sin_reduced(double x) { return sin_series(x * x, x, 0); }
+    constexpr double sin(double x) { return sin_reduced(x - 2 * kPi * round(x / (2 * kPi))); }
+    constexpr double cos(double x) { return sin(x + 0.5 * kPi); }
+
+    /** Taylor series of exp(x) from term k onwards, for small |x| */
+    constexpr double exp_series(double x, double term, int k) {
+      return (k > 12) ? term : term + exp_series(x, term * x / (k + 1), k + 1);
+    }
+
+    /** Exponential, argument halved until small then squared back */
+    constexpr double exp(double x) { return (abs(x) > 0.25) ? sq(exp(0.5 * x)) : exp_series(x, 1.0, 0); }
+    constexpr double pow2(double x) { return exp(kLn2 * x); }
+
+    /** Hyperbolic tangent, saturated beyond |x| > 20 */
+    constexpr double tanh(double x) { return (x > 20) ? 1.0 : (x < -20) ? -1.0 : 1.0 - 2.0 / (exp(2 * x) + 1.0); }
+
+    /*===========================================================================*/
+    /* Index Sequences.                                                          */
+    /*===========================================================================*/
+
+    /** Compile-time list of indices */
+    template <size_t... Is>
+    struct Indices { };
+
+    template <typename S0, typename S1>
+    struct ConcatIndices;
+
+    template <size_t... I0, size_t... I1>
+    struct ConcatIndices<Indices<I0...>, Indices<I1...> > {
+      typedef Indices<I0..., (sizeof...(I0) + I1)...> type;
+    };
+
+    /** Indices 0 ... N-1, built in log2(N) template depth so large tables stay within compiler limits */
+    template <size_t N>
+    struct MakeIndices {
+      typedef typename ConcatIndices<typename MakeIndices<N / 2>::type,
+                                     typename MakeIndices<N - N / 2>::type>::type type;
+    };
+
+    template <> struct MakeIndices<0> { typedef Indices<> type; };
+    template <> struct MakeIndices<1> { typedef Indices<0> type; };
+  }
+
+  /**
+   * Table generators, eval(i, n) returns the value at index i of an n sized table (plus guard point at i == n).
+   */
+  namespace lut {
+
+    /** One period of sine, sin(2*pi*i/n) */
+    struct Sine {
+      static constexpr double eval(size_t i, size_t n) { return cx::sin(2 * cx::kPi * i / n); }
+    };
+
+    /** Hyperbolic tangent over [-R, R] */
+    template <int R>
+    struct Tanh {
+      static constexpr double eval(size_t i, size_t n) { return cx::tanh(R * (2.0 * i / n - 1.0)); }
+    };
+
+    /** 2^x over [0, 1], e.g. for fine tuning ratios */
+    struct Pow2 {
+      static constexpr double eval(size_t i, size_t n) { return cx::pow2((double)i / n); }
+    };
+
+    /**
+     * Normalized exponential curve over [0, 1], (e^(K*x) - 1) / (e^K - 1).
+     * Positive K for convex (attack-like) curves, negative K for concave ones. K must not be 0.
+     */
+    template <int K>
+    struct ExpCurve {
+      static constexpr double eval(size_t i, size_t n) { return (cx::exp(K * (double)i / n) - 1.0) / (cx::exp(K) - 1.0); }
+    };
+
+    /** Cubic soft clip over [-1, 1] input range, 1.5*x - 0.5*x^3 */
+    struct CubicSat {
+      static constexpr double eval(size_t i, size_t n) { return 1.5 * (2.0 * i / n - 1.0) - 0.5 * (2.0 * i / n - 1.0) * (2.0 * i / n - 1.0) * (2.0 * i / n - 1.0); }
+    };
+
+    /** MIDI note number to frequency in Hz, index is the note number, n is ignored */
+    struct MidiHz {
+      static constexpr double eval(size_t i, size_t) { return 440.0 * cx::pow2(((double)i - 69) / 12.0); }
+    };
+
+    /** MIDI note number to normalized phase increment (Hz / SR), index is the note number, n is ignored */
+    template <uint32_t SR = 48000>
+    struct MidiW0 {
+      static constexpr double eval(size_t i, size_t n) { return MidiHz::eval(i, n) / SR; }
+    };
+  }
+
+  /**
+   * Compile-time generated lookup table.
+   *
+   * Holds N + 1 entries, following the k_*_lut_size = size+1 convention, so the last point
+   * is a guard value for linear interpolation. Being constexpr, the data is placed in .rodata
+   * (flash) and costs no initialization cycles.
+   *
+   * @tparam Gen Generator type exposing static constexpr double eval(size_t i, size_t n).
+   * @tparam N   Table size (number of intervals), power of two recommended.
+   *
+   * Example: typedef dsp::ConstLUT<dsp::lut::Tanh<3>, 256> tanh_lut_t;
+   */
+  template <typename Gen, size_t N, typename Seq = typename cx::MakeIndices<N + 1>::type>
+  struct ConstLUT;
+
+  template <typename Gen, size_t N, size_t... Is>
+  struct ConstLUT<Gen, N, cx::Indices<Is...> > {
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    static constexpr size_t size = N;
+    static constexpr size_t lut_size = N + 1;
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Direct access to table entry
+     *
+     * @param idx Index in [0, N]
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float at(const uint32_t idx)
+    {
+      return data[idx];
+    }
+
+    /**
+     * Linearly interpolated lookup
+     *
+     * @param x Position in [0, 1] spanning the whole table, not range checked below 0
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float linint(const float x)
+    {
+      const float p = x * N;
+      uint32_t i = (uint32_t)p;
+      i = (i < N) ? i : N - 1;
+      const float fr = p - i;
+      return linintf(fr, data[i], data[i+1]);
+    }
+
+    /**
+     * Linearly interpolated lookup for periodic tables
+     *
+     * @param x Position in cycles, wrapped to [0, 1)
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float linint_wrap(const float x)
+    {
+      float w = x - (int32_t)x;
+      w += (w < 0.f) ? 1.f : 0.f;
+      return linint(w);
+    }
+
+    /**
+     * Linearly interpolated lookup over a bipolar input range
+     *
+     * @param x Position in [-1, 1] spanning the whole table, clipped
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    float linint_bipolar(const float x)
+    {
+      return linint(0.5f * clip1m1f(x) + 0.5f);
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    static constexpr float data[N + 1] = { (float)Gen::eval(Is, N)... };
+  };
+
+  template <typename Gen, size_t N, size_t... Is>
+  constexpr float ConstLUT<Gen, N, cx::Indices<Is...> >::data[N + 1];
+
+}
+
+/** @} */
@@ -0,0 +1,103 @@
+#pragma once
+/*
+ * minBLEP residual table for dsp::VAOsc, generated by tools/minblep/minblep.py
+ * minblep.py -z 16 -s 32 -c 0.9
+ *
+ * Entry k is (minBLEP step - 1) at k/32 samples after the discontinuity.
+ */
+
+#define k_minblep_zero_crossings (16)
+#define k_minblep_oversampling   (32)
+#define k_minblep_lut_size       (k_minblep_zero_crossings * k_minblep_oversampling + 1)
+
+/** Group delay of the minBLEP step in samples, i.e. minus the integral of the residual */
+#define k_minblep_delay          (2.31249965e+00f)
+
+static const float minblep_lut_f[k_minblep_lut_size] = {
+  -9.99999969e-01f, -9.99999876e-01f, -9.99999645e-01f, -9.99999159e-01f, -9.99998250e-01f, -9.99996685e-01f,
+  -9.99994153e-01f, -9.99990252e-01f, -9.99984470e-01f, -9.99976165e-01f, -9.99964549e-01f, -9.99948663e-01f,
+  -9.99927354e-01f, -9.99899251e-01f, -9.99862737e-01f, -9.99815925e-01f, -9.99756623e-01f, -9.99682311e-01f,
+  -9.99590105e-01f, -9.99476729e-01f, -9.99338476e-01f, -9.99171182e-01f, -9.98970191e-01f, -9.98730321e-01f,
+  -9.98445833e-01f, -9.98110401e-01f, -9.97717081e-01f, -9.97258282e-01f, -9.96725742e-01f, -9.96110505e-01f,
+  -9.95402895e-01f, -9.94592504e-01f, -9.93668175e-01f, -9.92617992e-01f, -9.91429276e-01f, -9.90088582e-01f,
+  -9.88581703e-01f, -9.86893684e-01f, -9.85008832e-01f, -9.82910744e-01f, -9.80582332e-01f, -9.78005861e-01f,
+  -9.75162988e-01f, -9.72034818e-01f, -9.68601953e-01f, -9.64844565e-01f, -9.60742462e-01f, -9.56275171e-01f,
+  -9.51422022e-01f, -9.46162243e-01f, -9.40475061e-01f, -9.34339810e-01f, -9.27736044e-01f, -9.20643654e-01f,
+  -9.13042999e-01f, -9.04915031e-01f, -8.96241428e-01f, -8.87004738e-01f, -8.77188511e-01f, -8.66777447e-01f,
+  -8.55757538e-01f, -8.44116209e-01f, -8.31842462e-01f, -8.18927020e-01f, -8.05362457e-01f, -7.91143343e-01f,
+  -7.76266363e-01f, -7.60730446e-01f, -7.44536879e-01f, -7.27689416e-01f, -7.10194375e-01f, -6.92060727e-01f,
+  -6.73300173e-01f, -6.53927210e-01f, -6.33959176e-01f, -6.13416296e-01f, -5.92321697e-01f, -5.70701417e-01f,
+  -5.48584396e-01f, -5.26002448e-01f, -5.02990218e-01f, -4.79585118e-01f, -4.55827251e-01f, -4.31759310e-01f,
+  -4.07426466e-01f, -3.82876231e-01f, -3.58158310e-01f, -3.33324430e-01f, -3.08428159e-01f, -2.83524702e-01f,
+  -2.58670686e-01f, -2.33923929e-01f, -2.09343199e-01f, -1.84987956e-01f, -1.60918086e-01f, -1.37193628e-01f,
+  -1.13874485e-01f, -9.10201405e-02f, -6.86893592e-02f, -4.69398921e-02f, -2.58281775e-02f, -5.40904329e-03f,
+  1.42645881e-02f, 3.31419897e-02f, 5.11749143e-02f, 6.83178696e-02f, 8.45283832e-02f, 9.97672553e-02f,
+  1.13998798e-01f, 1.27191056e-01f, 1.39316017e-01f, 1.50349792e-01f, 1.60272783e-01f, 1.69069829e-01f,
+  1.76730324e-01f, 1.83248313e-01f, 1.88622563e-01f, 1.92856609e-01f, 1.95958768e-01f, 1.97942134e-01f,
+  1.98824537e-01f, 1.98628480e-01f, 1.97381047e-01f, 1.95113782e-01f, 1.91862543e-01f, 1.87667331e-01f,
+  1.82572090e-01f, 1.76624485e-01f, 1.69875657e-01f, 1.62379959e-01f, 1.54194664e-01f, 1.45379662e-01f,
+  1.35997138e-01f, 1.26111237e-01f, 1.15787710e-01f, 1.05093560e-01f, 9.40966698e-02f, 8.28654305e-02f,
+  7.14683654e-02f, 5.99737513e-02f, 4.84492427e-02f, 3.69615000e-02f, 2.55758236e-02f, 1.43557977e-02f,
+  3.36294456e-03f, -7.34360750e-03f, -1.77074401e-02f, -2.76751433e-02f, -3.71965944e-02f, -4.62252149e-02f,
+  -5.47182043e-02f, -6.26367489e-02f, -6.99462049e-02f, -7.66162537e-02f, -8.26210294e-02f, -8.79392165e-02f,
+  -9.25541188e-02f, -9.64536978e-02f, -9.96305810e-02f, -1.02082041e-01f, -1.03809943e-01f, -1.04820665e-01f,
+  -1.05124990e-01f, -1.04737967e-01f, -1.03678749e-01f, -1.01970406e-01f, -9.96397099e-02f, -9.67169042e-02f,
+  -9.32354466e-02f, -8.92317377e-02f, -8.47448317e-02f, -7.98161335e-02f, -7.44890829e-02f, -6.88088308e-02f,
+  -6.28219067e-02f, -5.65758824e-02f, -5.01190326e-02f, -4.34999966e-02f, -3.67674410e-02f, -2.99697285e-02f,
+  -2.31545931e-02f, -1.63688250e-02f, -9.65796660e-03f, -3.06602282e-03f, 3.36481397e-03f, 9.59442122e-03f,
+  1.55849848e-02f, 2.13012171e-02f, 2.67105537e-02f, 3.17833268e-02f, 3.64929155e-02f, 4.08158710e-02f,
+  4.47320168e-02f, 4.82245242e-02f, 5.12799612e-02f, 5.38883164e-02f, 5.60429975e-02f, 5.77408050e-02f,
+  5.89818812e-02f, 5.97696363e-02f, 6.01106509e-02f, 6.00145581e-02f, 5.94939051e-02f, 5.85639952e-02f,
+  5.72427136e-02f, 5.55503368e-02f, 5.35093284e-02f, 5.11441229e-02f, 4.84808983e-02f, 4.55473420e-02f,
+  4.23724089e-02f, 3.89860758e-02f, 3.54190929e-02f, 3.17027361e-02f, 2.78685587e-02f, 2.39481482e-02f,
+  1.99728880e-02f, 1.59737249e-02f, 1.19809468e-02f, 8.02396920e-03f, 4.13113454e-03f, 3.29523381e-04f,
+  -3.35521952e-03f, -6.89904421e-03f, -1.02796383e-02f, -1.34765527e-02f, -1.64713102e-02f, -1.92474953e-02f,
+  -2.17908264e-02f, -2.40892092e-02f, -2.61327717e-02f, -2.79138806e-02f, -2.94271399e-02f, -3.06693717e-02f,
+  -3.16395802e-02f, -3.23388988e-02f, -3.27705222e-02f, -3.29396235e-02f, -3.28532580e-02f, -3.25202541e-02f,
+  -3.19510932e-02f, -3.11577796e-02f, -3.01537015e-02f, -2.89534843e-02f, -2.75728389e-02f, -2.60284042e-02f,
+  -2.43375876e-02f, -2.25184024e-02f, -2.05893064e-02f, -1.85690395e-02f, -1.64764655e-02f, -1.43304160e-02f,
+  -1.21495398e-02f, -9.95215756e-03f, -7.75612411e-03f, -5.57869774e-03f, -3.43641882e-03f, -1.34499777e-03f,
+  6.80786873e-04f, 2.62717954e-03f, 4.48152754e-03f, 6.23234934e-03f, 7.86939114e-03f, 9.38367135e-03f,
+  1.07675132e-02f, 1.20145654e-02f, 1.31198111e-02f, 1.40795650e-02f, 1.48914600e-02f, 1.55544227e-02f,
+  1.60686387e-02f, 1.64355088e-02f, 1.66575959e-02f, 1.67385640e-02f, 1.66831094e-02f, 1.64968864e-02f,
+  1.61864256e-02f, 1.57590492e-02f, 1.52227811e-02f, 1.45862544e-02f, 1.38586169e-02f, 1.30494350e-02f,
+  1.21685977e-02f, 1.12262208e-02f, 1.02325523e-02f, 9.19788018e-03f, 8.13244287e-03f, 7.04634336e-03f,
+  5.94946740e-03f, 4.85140654e-03f, 3.76138641e-03f, 2.68820080e-03f, 1.64015179e-03f, 6.24996477e-04f,
+  -3.50099671e-04f, -1.27860252e-03f, -2.15464194e-03f, -2.97303745e-03f, -3.72931680e-03f, -4.41972754e-03f,
+  -5.04124181e-03f, -5.59155448e-03f, -6.06907486e-03f, -6.47291235e-03f, -6.80285642e-03f, -7.05935113e-03f,
+  -7.24346485e-03f, -7.35685549e-03f, -7.40173169e-03f, -7.38081067e-03f, -7.29727292e-03f, -7.15471469e-03f,
+  -6.95709838e-03f, -6.70870169e-03f, -6.41406590e-03f, -6.07794374e-03f, -5.70524751e-03f, -5.30099773e-03f,
+  -4.87027294e-03f, -4.41816096e-03f, -3.94971213e-03f, -3.46989472e-03f, -2.98355309e-03f, -2.49536859e-03f,
+  -2.00982371e-03f, -1.53116954e-03f, -1.06339676e-03f, -6.10210299e-04f, -1.75007779e-04f, 2.39138271e-04f,
+  6.29494351e-04f, 9.93676155e-04f, 1.32965500e-03f, 1.63576062e-03f, 1.91068045e-03f, 2.15345548e-03f,
+  2.36347305e-03f, 2.54045647e-03f, 2.68445206e-03f, 2.79581358e-03f, 2.87518445e-03f, 2.92347798e-03f,
+  2.94185586e-03f, 2.93170533e-03f, 2.89461504e-03f, 2.83235025e-03f, 2.74682731e-03f, 2.64008793e-03f,
+  2.51427344e-03f, 2.37159921e-03f, 2.21432960e-03f, 2.04475353e-03f, 1.86516103e-03f, 1.67782080e-03f,
+  1.48495907e-03f, 1.28873999e-03f, 1.09124740e-03f, 8.94468427e-04f, 7.00278748e-04f, 5.10429703e-04f,
+  3.26537249e-04f, 1.50072827e-04f, -1.76438844e-05f, -1.75450333e-04f, -3.22344607e-04f, -4.57487178e-04f,
+  -5.80200918e-04f, -6.89969496e-04f, -7.86434214e-04f, -8.69389418e-04f, -9.38776550e-04f, -9.94677012e-04f,
+  -1.03730395e-03f, -1.06699309e-03f, -1.08419286e-03f, -1.08945375e-03f, -1.08341728e-03f, -1.06680454e-03f,
+  -1.04040447e-03f, -1.00506211e-03f, -9.61666825e-04f, -9.11140705e-04f, -8.54427246e-04f, -7.92480398e-04f,
+  -7.26254059e-04f, -6.56692123e-04f, -5.84719137e-04f, -5.11231648e-04f, -4.37090305e-04f, -3.63112771e-04f,
+  -2.90067473e-04f, -2.18668212e-04f, -1.49569641e-04f, -8.33636081e-05f, -2.05763634e-05f, 3.83333911e-05f,
+  9.29756050e-05f, 1.43029196e-04f, 1.88241592e-04f, 2.28427575e-04f, 2.63467469e-04f, 2.93304731e-04f,
+  3.17942996e-04f, 3.37442623e-04f, 3.51916803e-04f, 3.61527287e-04f, 3.66479807e-04f, 3.67019262e-04f,
+  3.63424752e-04f, 3.56004509e-04f, 3.45090804e-04f, 3.31034844e-04f, 3.14201762e-04f, 2.94965699e-04f,
+  2.73705074e-04f, 2.50798058e-04f, 2.26618330e-04f, 2.01531102e-04f, 1.75889463e-04f, 1.50031041e-04f,
+  1.24275001e-04f, 9.89194108e-05f, 7.42389728e-05f, 5.04831744e-05f, 2.78748258e-05f, 6.60900723e-06f,
+  -1.31476150e-05f, -3.12571073e-05f, -4.76102529e-05f, -6.21262061e-05f, -7.47518327e-05f, -8.54607548e-05f,
+  -9.42521214e-05f, -1.01149150e-04f, -1.06197466e-04f, -1.09463282e-04f, -1.11031437e-04f, -1.11003304e-04f,
+  -1.09494592e-04f, -1.06633058e-04f, -1.02556162e-04f, -9.74087060e-05f, -9.13405156e-05f, -8.45041712e-05f,
+  -7.70528432e-05f, -6.91382158e-05f, -6.09085272e-05f, -5.25067356e-05f, -4.40688271e-05f, -3.57223128e-05f,
+  -2.75849010e-05f, -1.97634001e-05f, -1.23527868e-05f, -5.43549623e-06f, 9.19144239e-07f, 6.65526192e-06f,
+  1.17306128e-05f, 1.61165109e-05f, 1.97975430e-05f, 2.27710577e-05f, 2.50464581e-05f, 2.66443537e-05f,
+  2.75955612e-05f, 2.79400307e-05f, 2.77256316e-05f, 2.70068863e-05f, 2.58435842e-05f, 2.42993914e-05f,
+  2.24404262e-05f, 2.03338960e-05f, 1.80467817e-05f, 1.56445864e-05f, 1.31901486e-05f, 1.07424889e-05f,
+  8.35575724e-06f, 6.07825942e-06f, 3.95168948e-06f, 2.01053298e-06f, 2.81734488e-07f, -1.21544927e-06f,
+  -2.46938958e-06f, -3.47587339e-06f, -4.23774260e-06f, -4.76435503e-06f, -5.07089756e-06f, -5.17749876e-06f,
+  -5.10825990e-06f, -4.89017961e-06f, -4.55213277e-06f, -4.12386077e-06f, -3.63503028e-06f, -3.11429758e-06f,
+  -2.58835759e-06f, -2.08099049e-06f, -1.61214394e-06f, -1.19721762e-06f, -8.46543647e-07f, -5.65269603e-07f,
+  -3.53522897e-07f, -2.06843208e-07f, -1.16857177e-07f, -7.21424985e-08f, -5.92616237e-08f, -6.41260256e-08f,
+  -7.37484656e-08f, -7.78216066e-08f, -7.05750274e-08f, -5.19075525e-08f, -2.68234220e-08f, -4.28268832e-09f,
+  6.73575995e-09f, 6.58053789e-09f, 0.00000000e+00f,
+};
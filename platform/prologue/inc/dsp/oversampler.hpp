@@ -0,0 +1,360 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    oversampler.hpp
+ * @brief   Polyphase IIR halfband oversampling.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * 2x polyphase halfband filter made of two allpass chains (after L. de Soras' HIIR).
+   *
+   * Coefficients alternate between the two branches, each coefficient costs one multiply per input sample
+   * when upsampling and per output sample when downsampling.
+   *
+   * @tparam NC Number of allpass coefficients.
+   */
+  template <uint32_t NC>
+  struct HalfbandIIR {
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Default constructor
+     */
+    HalfbandIIR(void)
+    {
+      for (uint32_t i = 0; i < NC; ++i)
+        mC[i] = 0.f;
+      flush();
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Set allpass coefficients
+     *
+     * @param c Array of NC coefficients.
+     */
+    inline void setCoeffs(const float *c)
+    {
+      for (uint32_t i = 0; i < NC; ++i)
+        mC[i] = c[i];
+    }
+
+    /**
+     * Clear state
+     */
+    inline void flush(void)
+    {
+      for (uint32_t i = 0; i < NC; ++i)
+        mX[i] = mY[i] = 0.f;
+    }
+
+    /**
+     * Upsample one sample to two
+     *
+     * @param x  Input sample
+     * @param y0 First output sample
+     * @param y1 Second output sample
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void up(const float x, float &y0, float &y1)
+    {
+      float a = x, b = x;
+      chain(a, b, mC, mX, mY);
+      y0 = a;
+      y1 = b;
+    }
+
+    /**
+     * Downsample two samples to one
+     *
+     * @param x0 First input sample
+     * @param x1 Second input sample
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float down(const float x0, const float x1)
+    {
+      float a = x1, b = x0;
+      chain(a, b, mC, mX, mY);
+      return 0.5f * (a + b);
+    }
+
+    /**
+     * Upsample a block, in and out may overlap as long as y >= x + frames is never read after being written
+     *
+     * @param x      Input, frames samples
+     * @param y      Output, 2*frames samples
+     * @param frames Number of input samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void up_block(const float *x, float *y, const uint32_t frames)
+    {
+      // Local state, buffer stores could otherwise alias the members and force reloads
+      float c[NC], sx[NC], sy[NC];
+      load(c, sx, sy);
+      const float * x_e = x + frames;
+      for (; x != x_e; y += 2) {
+        float a = *x, b = *(x++);
+        chain(a, b, c, sx, sy);
+        y[0] = a;
+        y[1] = b;
+      }
+      store(sx, sy);
+    }
+
+    /**
+     * Downsample a block, can be done in place
+     *
+     * @param x      Input, 2*frames samples
+     * @param y      Output, frames samples
+     * @param frames Number of output samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void down_block(const float *x, float *y, const uint32_t frames)
+    {
+      float c[NC], sx[NC], sy[NC];
+      load(c, sx, sy);
+      const float * y_e = y + frames;
+      for (; y != y_e; x += 2) {
+        float a = x[1], b = x[0];
+        chain(a, b, c, sx, sy);
+        *(y++) = 0.5f * (a + b);
+      }
+      store(sx, sy);
+    }
+
+    /*===========================================================================*/
+    /* Private Methods.                                                          */
+    /*===========================================================================*/
+
+    /**
+     * Run both allpass branches, even coefficients on a, odd ones on b
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    void chain(float &a, float &b, const float *c, float *sx, float *sy)
+    {
+      for (uint32_t i = 0; i < NC; i += 2) {
+        const float ya = (a - sy[i]) * c[i] + sx[i];
+        sx[i] = a;
+        sy[i] = ya;
+        a = ya;
+        if (i + 1 < NC) {
+          const float yb = (b - sy[i+1]) * c[i+1] + sx[i+1];
+          sx[i+1] = b;
+          sy[i+1] = yb;
+          b = yb;
+        }
+      }
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void load(float *c, float *sx, float *sy) const
+    {
+      for (uint32_t i = 0; i < NC; ++i) {
+        c[i] = mC[i];
+        sx[i] = mX[i];
+        sy[i] = mY[i];
+      }
+    }
+
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void store(const float *sx, const float *sy)
+    {
+      for (uint32_t i = 0; i < NC; ++i) {
+        mX[i] = sx[i];
+        mY[i] = sy[i];
+      }
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    float mC[NC];
+    float mX[NC];
+    float mY[NC];
+  };
+
+  /**
+   * 2x, 4x or 8x oversampler built from cascaded halfband stages.
+   *
+   * Each stage keeps a 20kHz passband at 48kHz base rate, stopband rejection is 88dB for the first stage (7 coefficients),
+   * 84dB for the second (4) and 76dB for the third (3). Per base rate sample, a round trip costs 14 allpass updates
+   * at 2x, 30 at 4x and 54 at 8x. Holds filter state only, the oversampled block lives in a caller provided buffer
+   * of frames * Factor floats, e.g. a static float[64 * Factor] in the unit.
+   *
+   * @tparam Factor Oversampling factor, 2, 4 or 8.
+   */
+  template <uint32_t Factor>
+  class Oversampler {
+  public:
+
+    static_assert(Factor == 2 || Factor == 4 || Factor == 8, "Oversampler factor must be 2, 4 or 8");
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    static const uint32_t kFactor = Factor;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Default constructor
+     */
+    Oversampler(void)
+    {
+      static const float c1[7] = {
+        0.050638919498f, 0.184204312981f, 0.358957975694f, 0.535346236459f,
+        0.691492524230f, 0.823840380268f, 0.941480938750f
+      };
+      static const float c2[4] = {
+        0.061845867849f, 0.231494963866f, 0.478980557243f, 0.798233685546f
+      };
+      static const float c3[3] = {
+        0.081984180032f, 0.317132199249f, 0.710942571718f
+      };
+      mUp1.setCoeffs(c1); mDown1.setCoeffs(c1);
+      mUp2.setCoeffs(c2); mDown2.setCoeffs(c2);
+      mUp3.setCoeffs(c3); mDown3.setCoeffs(c3);
+    }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Clear filter states
+     */
+    inline void flush(void)
+    {
+      mUp1.flush(); mDown1.flush();
+      mUp2.flush(); mDown2.flush();
+      mUp3.flush(); mDown3.flush();
+    }
+
+    /**
+     * Round trip latency of upsample() then downsample(), in base rate samples at low frequencies
+     */
+    static inline float getLatency(void)
+    {
+      return (Factor == 2) ? 2.69f : (Factor == 4) ? 3.68f : 4.07f;
+    }
+
+    /**
+     * Upsample a block
+     *
+     * @param x      Input, frames samples
+     * @param y      Output, frames * Factor samples, must not overlap x
+     * @param frames Number of base rate samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void upsample(const float *x, float *y, const uint32_t frames)
+    {
+      // Each stage writes to the tail of y so that the next one can expand forward in place
+      switch (Factor) {
+      case 2:
+        mUp1.up_block(x, y, frames);
+        break;
+      case 4:
+        mUp1.up_block(x, y + 2 * frames, frames);
+        mUp2.up_block(y + 2 * frames, y, 2 * frames);
+        break;
+      default:
+        mUp1.up_block(x, y + 6 * frames, frames);
+        mUp2.up_block(y + 6 * frames, y + 4 * frames, 2 * frames);
+        mUp3.up_block(y + 4 * frames, y, 4 * frames);
+        break;
+      }
+    }
+
+    /**
+     * Downsample a block, can be done in place
+     *
+     * @param x      Input, frames * Factor samples, overwritten for factors above 2
+     * @param y      Output, frames samples
+     * @param frames Number of base rate samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void downsample(float *x, float *y, const uint32_t frames)
+    {
+      switch (Factor) {
+      case 2:
+        mDown1.down_block(x, y, frames);
+        break;
+      case 4:
+        mDown2.down_block(x, x, 2 * frames);
+        mDown1.down_block(x, y, frames);
+        break;
+      default:
+        mDown3.down_block(x, x, 4 * frames);
+        mDown2.down_block(x, x, 2 * frames);
+        mDown1.down_block(x, y, frames);
+        break;
+      }
+    }
+
+  private:
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    HalfbandIIR<7> mUp1, mDown1;
+    HalfbandIIR<4> mUp2, mDown2;
+    HalfbandIIR<3> mUp3, mDown3;
+  };
+}
+
+/** @} */
@@ -0,0 +1,200 @@
+#pragma once
+/*
+    BSD 3-Clause License
+
+    Copyright (c) 2018, KORG INC.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//*/
+
+/**
+ * @file    phaseacc.hpp
+ * @brief   Integer phase accumulator.
+ *
+ * @addtogroup dsp DSP
+ * @{
+ */
+
+#include <stdint.h>
+
+#include "float_math.h"
+
+/**
+ * Common DSP Utilities
+ */
+namespace dsp {
+
+  /**
+   * Q32 phase accumulator, one period maps to the full uint32_t range.
+   *
+   * Wraparound is implicit in the unsigned overflow, no float to int conversion is needed per sample,
+   * and the increment resolution is Fs/2^32 (~11uHz at 48kHz) across the whole pitch range.
+   * Phase values can be fed directly to Q32 lookups such as osc_sinuf() and osc_wave_scanuf().
+   */
+  struct PhaseAcc {
+
+    /*===========================================================================*/
+    /* Types and Data Structures.                                                */
+    /*===========================================================================*/
+
+    /** Scale from [0, 1) phase ratio to Q32 */
+    static constexpr float kQ32 = 4294967296.f;
+    /** Scale from Q32 to [0, 1) phase ratio */
+    static constexpr float kQ32Recip = 2.3283064365386963e-10f;
+
+    /*===========================================================================*/
+    /* Constructor / Destructor.                                                 */
+    /*===========================================================================*/
+
+    /**
+     * Default constructor
+     */
+    PhaseAcc(void) :
+      phi(0), w0(0)
+    { }
+
+    /*===========================================================================*/
+    /* Public Methods.                                                           */
+    /*===========================================================================*/
+
+    /**
+     * Step phase one sample forward
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void cycle(void)
+    {
+      phi += w0;
+    }
+
+    /**
+     * Step phase one sample forward and report wraparound
+     *
+     * @return True if the phase wrapped during this step, i.e. a new period started.
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    bool cycleWrapped(void)
+    {
+      phi += w0;
+      return phi < w0;
+    }
+
+    /**
+     * Step phase forward by a number of samples
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void advance(const uint32_t frames)
+    {
+      phi += w0 * frames;
+    }
+
+    /**
+     * Reset phase
+     *
+     * @param p Phase to restart from, 0 by default.
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void reset(const uint32_t p = 0)
+    {
+      phi = p;
+    }
+
+    /**
+     * Hard sync to a master accumulator, to be called on the step where master.cycleWrapped() was true.
+     * The slave restarts with the sub-sample offset elapsed since the master wrapped, which avoids sync jitter.
+     *
+     * @param master Master accumulator, already stepped for the current sample.
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void sync(const PhaseAcc &master)
+    {
+      const float frac = (float)master.phi / (float)master.w0;
+      phi = (uint32_t)(frac * (float)w0);
+    }
+
+    /**
+     * Set phase increment
+     *
+     * @param w Normalized phase increment in [0, 1), e.g. from osc_w0f_for_note()
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setW0(const float w)
+    {
+      w0 = (uint32_t)(w * kQ32);
+    }
+
+    /**
+     * Set frequency
+     *
+     * @param f0 Frequency in Hz
+     * @param fsrecip Reciprocal of sampling frequency (1/Fs)
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    void setF0(const float f0, const float fsrecip)
+    {
+      setW0(f0 * fsrecip);
+    }
+
+    /**
+     * Get current phase as ratio in [0, 1)
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    float getPhasef(void) const
+    {
+      return kQ32Recip * (float)phi;
+    }
+
+    /**
+     * Get current phase with an offset applied, wrapping around
+     *
+     * @param offset Offset in periods, in (-1, 1)
+     */
+    inline __attribute__((optimize("Ofast"),always_inline))
+    uint32_t getPhaseOff(const float offset) const
+    {
+      return phi + toQ32Delta(offset);
+    }
+
+    /**
+     * Convert a signed phase offset in periods, in (-1, 1), to a Q32 delta
+     */
+    static inline __attribute__((optimize("Ofast"),always_inline))
+    uint32_t toQ32Delta(const float offset)
+    {
+      return ((uint32_t)(int32_t)(offset * 2147483648.f)) << 1;
+    }
+
+    /*===========================================================================*/
+    /* Member Vars                                                               */
+    /*===========================================================================*/
+
+    uint32_t phi;
+    uint32_t w0;
+  };
+}
+
+/** @} */
@@ -149,14 +149,19 @@ extern "C" {
   }
   
   /**
-   * Lookup value of sin(2*pi*x) in [0, 1.0] range.
+   * Lookup value of sin(2*pi*x), Q32 phase version.
    *
-   * @param   x  Phase ratio.
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
    * @return     Result of sin(2*pi*x).
    */
   __fast_inline float fx_sinuf(uint32_t x) {
-    (void)x;
-    return 0.f;
+    const uint32_t x0p = x >> k_wt_sine_u32shift;
+    const uint32_t x0 = x0p & k_wt_sine_mask;
+    const float fr = k_wt_sine_frrecip * (float)(x & ((1U<<k_wt_sine_u32shift)-1));
+    // half period stored, second half negated by flipping the sign bit
+    f32_t y0 = { linintf(fr, wt_sine_lut_f[x0], wt_sine_lut_f[x0 + 1]) };
+    y0.i ^= (x0p >> k_wt_sine_size_exp) << 31;
+    return y0.f;
   }
   
   /**
@@ -170,13 +175,60 @@ extern "C" {
   }
 
   /**
-   * Lookup value of cos(2*pi*x) in [0, 1.0] range.
+   * Lookup value of cos(2*pi*x), Q32 phase version.
    *
-   * @param   x  Phase ratio.
-   * @return     Result of sin(2*pi*x).
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
+   * @return     Result of cos(2*pi*x).
    */
   __fast_inline float fx_cosuf(uint32_t x) {
-    return fx_sinuf(x+((k_wt_sine_size>>2)<<k_wt_sine_u32shift));
+    return fx_sinuf(x + (1U<<30));
+  }
+
+  /**
+   * Lookup quadrature pair sin(2*pi*x), cos(2*pi*x), Q32 phase version.
+   *
+   * @param   x  Phase in [0, 2^32) mapped to [0, 1.0).
+   * @param   s  Result of sin(2*pi*x).
+   * @param   c  Result of cos(2*pi*x).
+   */
+  __fast_inline void fx_sincosuf(uint32_t x, float *s, float *c) {
+    *s = fx_sinuf(x);
+    *c = fx_sinuf(x + (1U<<30));
+  }
+
+  /**
+   * Render a sine over a block, Q32 phase version.
+   *
+   * @param   y       Output buffer.
+   * @param   frames  Number of samples.
+   * @param   x       Start phase.
+   * @param   w0      Phase increment per sample.
+   * @return          Phase after the last sample.
+   */
+  __fast_inline uint32_t fx_sinuf_block(float * __restrict y, uint32_t frames, uint32_t x, uint32_t w0) {
+    const float * y_e = y + frames;
+    for (; y != y_e; x += w0)
+      *(y++) = fx_sinuf(x);
+    return x;
+  }
+
+  /**
+   * Render a quadrature sine/cosine pair over a block, Q32 phase version.
+   *
+   * @param   s       Sine output buffer.
+   * @param   c       Cosine output buffer.
+   * @param   frames  Number of samples.
+   * @param   x       Start phase.
+   * @param   w0      Phase increment per sample.
+   * @return          Phase after the last sample.
+   */
+  __fast_inline uint32_t fx_sincosuf_block(float * __restrict s, float * __restrict c, uint32_t frames, uint32_t x, uint32_t w0) {
+    const float * s_e = s + frames;
+    for (; s != s_e; x += w0) {
+      *(s++) = fx_sinuf(x);
+      *(c++) = fx_sinuf(x + (1U<<30));
+    }
+    return x;
   }
   
   /** @} */
@@ -322,8 +374,8 @@ extern "C" {
    * @return     Cubic curve above 0.42264973081, gain: 1.2383127573
    */
   __fast_inline float fx_sat_cubicf(float x) {
-    const float xf = si_fabsf(clip1f(x)) * k_cubicsat_size;
-    const uint32_t xi = (uint32_t)x;
+    const float xf = si_fabsf(clip1m1f(x)) * k_cubicsat_size;
+    const uint32_t xi = clipmaxu32((uint32_t)xf, k_cubicsat_size - 1);
     const float y0 = cubicsat_lut_f[xi];
     const float y1 = cubicsat_lut_f[xi+1];
     return si_copysignf(linintf(xf - xi, y0, y1), x);
@@ -343,8 +395,8 @@ extern "C" {
    * @return     Saturated value.
    */
   __fast_inline float fx_sat_schetzenf(float x) {
-    const float xf = si_fabsf(clip1f(x)) * k_schetzen_size;
-    const uint32_t xi = (uint32_t)x;
+    const float xf = si_fabsf(clip1m1f(x)) * k_schetzen_size;
+    const uint32_t xi = clipmaxu32((uint32_t)xf, k_schetzen_size - 1);
     const float y0 = schetzen_lut_f[xi];
     const float y1 = schetzen_lut_f[xi+1];
     return si_copysignf(linintf(xf - xi, y0, y1), x);
@@ -12,8 +12,10 @@
 #include "usermodfx.h"
 
 #include "simplelfo.hpp"
+#include "fxbus.hpp"
 
 static dsp::SimpleLFO s_lfo;
+static bool s_sub_bus;
 
 enum {
   k_sin = 0,
@@ -28,6 +30,9 @@ enum {
   k_tri_off,
   k_saw_off,
   k_sqr_off,
+  k_saw_bl,
+  k_sqr_bl,
+  k_pls_bl,
   k_wave_count
 };
 
@@ -37,6 +42,7 @@ static const float s_fs_recip = 1.f / 48000.f;
 
 void MODFX_INIT(uint32_t platform, uint32_t api)
 {
+  s_sub_bus = dsp::fxHasSubBus(platform);
   s_lfo.reset();
   s_lfo.setF0(220.f,s_fs_recip);
 }
@@ -48,6 +54,7 @@ void MODFX_PROCESS(const float *main_xn, float *main_yn,
   float * __restrict my = main_yn;
   const float * my_e = my + 2*frames;
   float * __restrict sy = sub_yn;
+  const bool sub_bus = s_sub_bus;
 
   const float p = s_param;
   float p_z = s_param_z;
@@ -108,6 +115,18 @@ void MODFX_PROCESS(const float *main_xn, float *main_yn,
     case k_sqr_off:
       wave = s_lfo.square_bi_off(s_param_z);
       break;
+
+    case k_saw_bl:
+      wave = s_lfo.saw_bi_bl();
+      break;
+
+    case k_sqr_bl:
+      wave = s_lfo.square_bi_bl();
+      break;
+
+    case k_pls_bl:
+      wave = s_lfo.pulse_bi_bl(clipminmaxf(0.05f, s_param_z, 0.95f));
+      break;
     }
     
     // Scale down the wave, full swing is way too loud. (polyphony headroom)
@@ -115,8 +134,10 @@ void MODFX_PROCESS(const float *main_xn, float *main_yn,
     
     *(my++) = wave;
     *(my++) = wave;
-    *(sy++) = wave;
-    *(sy++) = wave;
+    if (sub_bus) {
+      *(sy++) = wave;
+      *(sy++) = wave;
+    }
   }
 
   s_param_z = p_z;
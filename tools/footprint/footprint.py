@@ -0,0 +1,416 @@
+#!/usr/bin/env python3
+"""Memory footprint and stack usage report for built user units.
+
+Reads the linked ELF for section and symbol sizes, the linker map (or the
+linker script) for the memory regions the unit must fit in, the .su files
+written by -fstack-usage for per function frame sizes, and optionally the
+objdump disassembly to follow calls and compute the worst case stack depth
+from each hook entry point. Only uses the Python standard library.
+
+Exits with status 1 and an "error:" line per violation when a region is over
+its length or under the requested headroom, or when a hook may exceed the
+requested stack limit.
+"""
+
+import argparse
+import glob
+import os
+import re
+import struct
+import subprocess
+import sys
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+SHT_SYMTAB = 2
+STT_OBJECT = 1
+STT_FUNC = 2
+
+HOOKS = ('_hook_init', '_hook_cycle', '_hook_on', '_hook_off', '_hook_mute',
+         '_hook_value', '_hook_param', '_hook_process', '_hook_suspend',
+         '_hook_resume')
+
+
+# -----------------------------------------------------------------------------
+# ELF
+
+def read_elf(path):
+    """Return (sections, symbols) of a 32 or 64-bit little endian ELF file.
+
+    sections: list of dict(name, addr, size, alloc, nobits)
+    symbols:  list of dict(name, addr, size, kind, section)
+    """
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'\x7fELF':
+        raise ValueError('%s: not an ELF file' % path)
+    is64 = data[4] == 2
+    if data[5] != 1:
+        raise ValueError('%s: only little endian ELF is supported' % path)
+
+    if is64:
+        shoff, = struct.unpack_from('<Q', data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x3A)
+        sh_fmt = '<IIQQQQIIQQ'
+    else:
+        shoff, = struct.unpack_from('<I', data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x2E)
+        sh_fmt = '<IIIIIIIIII'
+
+    raw = []
+    for i in range(shnum):
+        (name, stype, flags, addr, offset, size, link, _info, _align,
+         entsize) = struct.unpack_from(sh_fmt, data, shoff + i * shentsize)
+        raw.append((name, stype, flags, addr, offset, size, link, entsize))
+
+    def cstr(table_off, off):
+        end = data.index(b'\0', table_off + off)
+        return data[table_off + off:end].decode('utf-8', 'replace')
+
+    strtab_off = raw[shstrndx][4]
+    sections = []
+    for name, stype, flags, addr, offset, size, link, entsize in raw:
+        sections.append({
+            'name': cstr(strtab_off, name),
+            'addr': addr,
+            'size': size,
+            'alloc': bool(flags & SHF_ALLOC),
+            'nobits': stype == SHT_NOBITS,
+        })
+
+    symbols = []
+    for name, stype, flags, addr, offset, size, link, entsize in raw:
+        if stype != SHT_SYMTAB:
+            continue
+        names_off = raw[link][4]
+        for i in range(size // entsize):
+            off = offset + i * entsize
+            if is64:
+                st_name, st_info, _other, st_shndx, st_value, st_size = \
+                    struct.unpack_from('<IBBHQQ', data, off)
+            else:
+                st_name, st_value, st_size, st_info, _other, st_shndx = \
+                    struct.unpack_from('<IIIBBH', data, off)
+            kind = st_info & 0xF
+            if kind not in (STT_OBJECT, STT_FUNC) or st_size == 0:
+                continue
+            if st_shndx == 0 or st_shndx >= len(sections):
+                continue
+            symbols.append({
+                'name': cstr(names_off, st_name),
+                'addr': st_value & ~1 if kind == STT_FUNC else st_value,
+                'size': st_size,
+                'kind': 'func' if kind == STT_FUNC else 'data',
+                'section': sections[st_shndx]['name'],
+            })
+    return sections, symbols
+
+
+# -----------------------------------------------------------------------------
+# Memory regions
+
+def parse_size(text):
+    text = text.strip()
+    mult = 1
+    if text[-1] in 'kK':
+        mult, text = 1024, text[:-1]
+    elif text[-1] in 'mM':
+        mult, text = 1024 * 1024, text[:-1]
+    return int(text, 0) * mult
+
+
+def regions_from_map(path):
+    """Memory Configuration table of a GNU ld map file."""
+    regions = []
+    with open(path, errors='replace') as f:
+        lines = f.read().splitlines()
+    try:
+        start = lines.index('Memory Configuration')
+    except ValueError:
+        return regions
+    for line in lines[start + 1:]:
+        if line.startswith('Linker script and memory map'):
+            break
+        fields = line.split()
+        if len(fields) < 3 or fields[0] in ('Name', '*default*'):
+            continue
+        try:
+            regions.append({'name': fields[0], 'origin': int(fields[1], 16),
+                            'length': int(fields[2], 16)})
+        except ValueError:
+            continue
+    return regions
+
+
+def regions_from_ld(path):
+    """MEMORY block of a linker script."""
+    with open(path, errors='replace') as f:
+        text = re.sub(r'/\*.*?\*/', '', f.read(), flags=re.S)
+    block = re.search(r'MEMORY\s*\{(.*?)\}', text, re.S)
+    regions = []
+    if not block:
+        return regions
+    for m in re.finditer(r'(\w+)\s*(?:\([^)]*\))?\s*:\s*(?:ORIGIN|org|o)\s*=\s*([^,]+),\s*'
+                         r'(?:LENGTH|len|l)\s*=\s*([^\s,]+)', block.group(1)):
+        regions.append({'name': m.group(1), 'origin': parse_size(m.group(2)),
+                        'length': parse_size(m.group(3))})
+    return regions
+
+
+def region_of(regions, addr):
+    for r in regions:
+        if r['origin'] <= addr < r['origin'] + r['length']:
+            return r['name']
+    return None
+
+
+# -----------------------------------------------------------------------------
+# Stack usage
+
+def split_top_level(text, sep=' '):
+    """Split on sep outside of <>, () and []."""
+    parts, depth, cur = [], 0, ''
+    for c in text:
+        if c in '<([':
+            depth += 1
+        elif c in '>)]':
+            depth -= 1
+        if c == sep and depth == 0:
+            parts.append(cur)
+            cur = ''
+        else:
+            cur += c
+    parts.append(cur)
+    return [p for p in parts if p]
+
+
+def function_key(name):
+    """Qualified function name without return type, parameters or offsets."""
+    # Template parameters are named in .su files, e.g. F<N>::run(float) [with int N = 8]
+    name, _, bindings = name.partition(' [with ')
+    for binding in bindings.rstrip(']').split('; '):
+        param, _, value = binding.partition(' = ')
+        if value:
+            name = re.sub(r'\b%s\b' % re.escape(param.split()[-1]), lambda m: value, name)
+    name = re.sub(r'\+0x[0-9a-fA-F]+$', '', name)
+    depth = 0
+    for i, c in enumerate(name):
+        if c == '<':
+            depth += 1
+        elif c == '>':
+            depth -= 1
+        elif c == '(' and depth == 0 and not name[:i].endswith('operator'):
+            name = name[:i]
+            break
+    parts = split_top_level(name.strip())
+    return parts[-1] if parts else name
+
+
+def read_su(paths):
+    """Frame size per function from -fstack-usage output."""
+    frames = {}
+    for path in paths:
+        with open(path, errors='replace') as f:
+            for line in f:
+                fields = line.rstrip('\n').split('\t')
+                if len(fields) < 3:
+                    continue
+                # file:line:col:name, name may itself contain ':'
+                loc = fields[0].split(':', 3)
+                key = function_key(loc[-1])
+                size = int(fields[1])
+                dynamic = fields[2].startswith('dynamic')
+                old = frames.get(key)
+                if old is None or size > old[0]:
+                    frames[key] = (size, dynamic)
+    return frames
+
+
+CALL_RE = re.compile(r'^\s*[0-9a-f]+:\s+(?:[0-9a-f]{2,8}\s+)*'
+                     r'(bl|blx|b|b\.w|b\.n|call|callq|jmp|jmpq)\s+'
+                     r'(?:[0-9a-f]+\s+<(.+)>\s*$|(\S+))')
+FUNC_RE = re.compile(r'^[0-9a-f]+ <(.+)>:$')
+
+
+def read_calls(objdump, elf):
+    """Direct callees of each function, and functions making indirect calls."""
+    out = subprocess.run([objdump, '-d', '-C', elf], check=True,
+                         stdout=subprocess.PIPE,
+                         universal_newlines=True).stdout
+    calls, indirect, current = {}, set(), None
+    for line in out.splitlines():
+        m = FUNC_RE.match(line)
+        if m:
+            current = function_key(m.group(1))
+            calls.setdefault(current, set())
+            continue
+        if current is None:
+            continue
+        m = CALL_RE.match(line)
+        if not m:
+            continue
+        op, target, reg = m.groups()
+        if target:
+            callee = function_key(target)
+            # Branches within the function are not calls
+            if callee != current:
+                calls[current].add(callee)
+        elif op in ('blx', 'call', 'callq') or (reg and reg.startswith('*')):
+            indirect.add(current)
+    return calls, indirect
+
+
+def demangle(names, objdump):
+    """Demangle with the c++filt next to objdump, names are left as they are without it."""
+    cxxfilt = re.sub(r'objdump(\.exe)?$', r'c++filt\1', objdump) if objdump else 'c++filt'
+    try:
+        out = subprocess.run([cxxfilt], input='\n'.join(names), check=True,
+                             stdout=subprocess.PIPE, universal_newlines=True).stdout
+    except (OSError, subprocess.CalledProcessError):
+        return names
+    result = out.splitlines()
+    return result if len(result) == len(names) else names
+
+
+def stack_depth(fn, frames, calls, indirect, memo, path):
+    """Worst case depth from fn, with flags for anything it could not bound."""
+    if fn in memo:
+        return memo[fn]
+    if fn in path:
+        return 0, {('recursion', fn)}
+    frame, dynamic = frames.get(fn, (0, False))
+    flags = set()
+    if fn not in frames:
+        flags.add(('no .su', fn))
+    if dynamic:
+        flags.add(('dynamic', fn))
+    if fn in indirect:
+        flags.add(('indirect', fn))
+    deepest = 0
+    path.add(fn)
+    for callee in sorted(calls.get(fn, ())):
+        depth, sub = stack_depth(callee, frames, calls, indirect, memo, path)
+        deepest = max(deepest, depth)
+        flags |= sub
+    path.discard(fn)
+    memo[fn] = (frame + deepest, flags)
+    return memo[fn]
+
+
+# -----------------------------------------------------------------------------
+# Report
+
+def fmt_flags(flags):
+    kinds = {}
+    for kind, fn in flags:
+        kinds.setdefault(kind, []).append(fn)
+    return '; '.join('%s: %s' % (k, ', '.join(sorted(v))) for k, v in sorted(kinds.items()))
+
+
+def fmt_bytes(n):
+    return '%d (%.1fK)' % (n, n / 1024.0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--elf', required=True, help='linked unit')
+    parser.add_argument('--map', help='linker map, for memory regions')
+    parser.add_argument('--ld', help='linker script, for memory regions when no map is given')
+    parser.add_argument('--su', nargs='*', default=[],
+                        help='.su files or directories holding them')
+    parser.add_argument('--objdump', help='objdump executable, enables call graph stack depths')
+    parser.add_argument('--top', type=int, default=10, help='number of largest symbols to list')
+    parser.add_argument('--min-headroom', action='append', default=[], metavar='REGION=BYTES',
+                        help='fail if a region has less free space, e.g. SRAM=1K')
+    parser.add_argument('--stack-limit', type=parse_size,
+                        help='fail if a hook may use more stack, in bytes')
+    args = parser.parse_args()
+
+    sections, symbols = read_elf(args.elf)
+    regions = []
+    if args.map:
+        regions = regions_from_map(args.map)
+    if not regions and args.ld:
+        regions = regions_from_ld(args.ld)
+
+    errors = []
+    print('Footprint of %s' % args.elf)
+
+    # Sections
+    print('\n  %-16s %-8s %10s %8s' % ('section', 'region', 'address', 'size'))
+    used = {}
+    for s in sections:
+        if not s['alloc'] or s['size'] == 0:
+            continue
+        region = region_of(regions, s['addr']) or '-'
+        print('  %-16s %-8s 0x%08x %8d' % (s['name'], region, s['addr'], s['size']))
+        if region != '-':
+            end = s['addr'] + s['size']
+            used[region] = max(used.get(region, 0), end)
+
+    # Regions, usage measured up to the end of the last section as the linker does
+    if regions:
+        minimum = {}
+        for spec in args.min_headroom:
+            name, _, value = spec.partition('=')
+            minimum[name] = parse_size(value)
+        print('\n  %-8s %18s %18s %18s' % ('region', 'used', 'length', 'headroom'))
+        for r in regions:
+            n = used.get(r['name'], r['origin']) - r['origin']
+            free = r['length'] - n
+            print('  %-8s %18s %18s %18s' % (r['name'], fmt_bytes(n), fmt_bytes(r['length']),
+                                             fmt_bytes(free)))
+            if free < 0:
+                errors.append('%s overflowed by %d bytes' % (r['name'], -free))
+            elif free < minimum.get(r['name'], 0):
+                errors.append('%s headroom %d bytes is below the required %d'
+                              % (r['name'], free, minimum[r['name']]))
+
+    # Largest symbols
+    if args.top > 0:
+        print('\n  %-8s %-10s %8s  %s' % ('kind', 'section', 'size', 'symbol'))
+        largest = sorted(symbols, key=lambda s: -s['size'])[:args.top]
+        names = demangle([s['name'] for s in largest], args.objdump)
+        for s, name in zip(largest, names):
+            print('  %-8s %-10s %8d  %s' % (s['kind'], s['section'], s['size'], name))
+
+    # Stack
+    su_files = []
+    for p in args.su:
+        su_files += sorted(glob.glob(os.path.join(p, '*.su'))) if os.path.isdir(p) else [p]
+    frames = read_su(su_files)
+    if frames:
+        hooks = [h for h in HOOKS if any(s['name'] == h for s in symbols)]
+        calls = None
+        if args.objdump:
+            try:
+                calls, indirect = read_calls(args.objdump, args.elf)
+            except (OSError, subprocess.CalledProcessError) as e:
+                print('\n  call graph skipped, %s' % e)
+        if calls is not None:
+            memo = {}
+            print('\n  %-16s %8s %8s  %s' % ('hook', 'frame', 'depth', 'unbounded'))
+            for h in hooks:
+                depth, flags = stack_depth(h, frames, calls, indirect, memo, set())
+                print('  %-16s %8d %8d  %s' % (h, frames.get(h, (0, False))[0], depth,
+                                              fmt_flags(flags)))
+                if args.stack_limit is not None and depth > args.stack_limit:
+                    errors.append('%s may use %d bytes of stack, limit is %d'
+                                  % (h, depth, args.stack_limit))
+        else:
+            print('\n  %-16s %8s' % ('hook', 'frame'))
+            for h in hooks:
+                print('  %-16s %8d' % (h, frames.get(h, (0, False))[0]))
+        if args.top > 0:
+            print('\n  %8s  %s' % ('frame', 'function'))
+        for name, (size, dynamic) in sorted(frames.items(), key=lambda i: -i[1][0])[:args.top]:
+            print('  %8d  %s%s' % (size, name, ' (dynamic)' if dynamic else ''))
+
+    print('')
+    for e in errors:
+        print('error: %s' % e, file=sys.stderr)
+    return 1 if errors else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
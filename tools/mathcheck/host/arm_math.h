@@ -0,0 +1,25 @@
+// Host stand-ins for the CMSIS intrinsics used by cortexm4.h
+#pragma once
+#include <stdint.h>
+#include <math.h>
+#define __SIMD32_TYPE int32_t
+#define PI 3.14159265358979f
+static inline int32_t __SSAT(int32_t v, uint32_t b){ int64_t m=(1LL<<(b-1)); return v>m-1?(int32_t)(m-1):(v<-m?(int32_t)-m:v);} 
+static inline uint32_t __USAT(int32_t v, uint32_t b){ int64_t m=(1LL<<b)-1; return v<0?0:(v>m?(uint32_t)m:(uint32_t)v);} 
+static inline int32_t __QADD(int32_t a,int32_t b){int64_t s=(int64_t)a+b; return s>INT32_MAX?INT32_MAX:(s<INT32_MIN?INT32_MIN:(int32_t)s);} 
+static inline int32_t __QSUB(int32_t a,int32_t b){int64_t s=(int64_t)a-b; return s>INT32_MAX?INT32_MAX:(s<INT32_MIN?INT32_MIN:(int32_t)s);} 
+// SEL picks bytes from the APSR.GE flags left by an earlier SIMD instruction, which a host
+// function cannot see, so any call that survives into the build fails it instead of guessing
+int32_t __SEL(int32_t, int32_t) __attribute__((error("__SEL() depends on APSR.GE flags and has no host stand-in")));
+static inline int32_t __host_ssat16(int32_t v){return v>32767?32767:(v<-32768?-32768:v);}
+static inline int32_t __QADD16(int32_t a,int32_t b){return (int32_t)(((uint32_t)__host_ssat16((a>>16)+(b>>16))<<16)|((uint32_t)__host_ssat16((int16_t)a+(int16_t)b)&0xFFFF));}
+static inline int32_t __QSUB16(int32_t a,int32_t b){return (int32_t)(((uint32_t)__host_ssat16((a>>16)-(b>>16))<<16)|((uint32_t)__host_ssat16((int16_t)a-(int16_t)b)&0xFFFF));}
+static inline uint32_t __CLZ(uint32_t x){return x?__builtin_clz(x):32;}
+static inline int32_t __SMUAD(int32_t a,int32_t b){return (int16_t)a*(int16_t)b+(int16_t)(a>>16)*(int16_t)(b>>16);} 
+static inline int32_t __SMLAD(int32_t a,int32_t b,int32_t c){return __SMUAD(a,b)+c;}
+static inline int32_t __PKHBT(int32_t a,int32_t b,int s){return (a&0xFFFF)|((b<<s)&0xFFFF0000);} 
+static inline int32_t __SMMLA(int32_t a,int32_t b,int32_t c){return (int32_t)(((int64_t)a*b)>>32)+c;}
+static inline int32_t __SXTB16(int32_t a){return (int32_t)(((uint32_t)(int32_t)(int8_t)(a>>16)<<16)|((uint32_t)(int32_t)(int8_t)a&0xFFFF));}
+static inline uint32_t __RBIT(uint32_t a){uint32_t r=0; for(int i=0;i<32;++i){r=(r<<1)|(a&1U); a>>=1;} return r;}
+static inline uint32_t __REV(uint32_t a){return __builtin_bswap32(a);}
+#define __NOP()
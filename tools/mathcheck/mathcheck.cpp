@@ -0,0 +1,226 @@
+/*
+ * Host checks for the utility headers shared by the platforms.
+ *
+ * Build and run against one platform's headers, see README.md:
+ *   g++ -O2 -std=c++11 -Ihost -I../../platform/prologue/inc/utils mathcheck.cpp -o mathcheck && ./mathcheck
+ *
+ * Exits with status 1 if any check fails.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <limits.h>
+#include <time.h>
+
+#include "buffer_ops.h"
+
+static int s_failed = 0;
+
+static void check(const bool ok, const char *what, const double got)
+{
+  printf("  %-40s %-4s %.9g\n", what, ok ? "ok" : "FAIL", got);
+  if (!ok)
+    ++s_failed;
+}
+
+// -----------------------------------------------------------------------------
+// Saturating Q31 conversion, must clamp and never wrap around
+
+static void check_sat(void)
+{
+  printf("f32_to_q31_sat\n");
+  const float hi[] = { 1.f, 1.0000001f, 1.5f, 2.f, 1e9f, INFINITY };
+  for (const float x : hi) {
+    char what[64];
+    snprintf(what, sizeof(what), "f32_to_q31_sat(%g) near INT_MAX", x);
+    const q31_t q = f32_to_q31_sat(x);
+    check(q > INT_MAX - 256, what, q);
+    snprintf(what, sizeof(what), "f32_to_q31_sat(%g) == INT_MIN", -x);
+    check(f32_to_q31_sat(-x) == INT_MIN, what, f32_to_q31_sat(-x));
+  }
+  check(f32_to_q31_sat(0.5f) == 0x40000000, "f32_to_q31_sat(0.5)", f32_to_q31_sat(0.5f));
+  check(f32_to_q31_sat(0.f) == 0, "f32_to_q31_sat(0)", f32_to_q31_sat(0.f));
+
+  float x[7] = { -2.f, -1.f, -0.25f, 0.f, 0.25f, 1.f, 2.f };
+  q31_t y[7];
+  buf_f32_to_q31_sat(x, y, 7);
+  bool monotonic = true;
+  for (int i = 1; i < 7; ++i)
+    monotonic &= y[i] >= y[i-1];
+  check(monotonic, "buf_f32_to_q31_sat monotonic", y[6]);
+}
+
+// -----------------------------------------------------------------------------
+// Approximation tiers, max error in float against double precision libm over the
+// domains of the accuracy table in float_math.h, which must not understate them
+
+typedef float (*unary_fn)(float);
+
+static double max_rel_pow2(const unary_fn fn)
+{
+  double e = 0;
+  for (int i = 0; i <= 2000000; ++i) {
+    const float p = -1.f + 2.f * i / 2000000;
+    e = fmax(e, fabs(fn(p) / exp2((double)p) - 1.0));
+  }
+  return e;
+}
+
+static double max_abs_log2(const unary_fn fn)
+{
+  double e = 0;
+  for (int i = 0; i <= 2000000; ++i) {
+    const float x = (float)exp2(-10.0 + 20.0 * i / 2000000);
+    e = fmax(e, fabs(fn(x) - log2((double)x)));
+  }
+  return e;
+}
+
+static double max_abs_sin(const unary_fn fn)
+{
+  double e = 0;
+  for (int i = 0; i <= 2000000; ++i) {
+    const float x = (float)(-M_PI + 2 * M_PI * i / 2000000);
+    e = fmax(e, fabs(fn(x) - sin((double)x)));
+  }
+  return e;
+}
+
+static float s_in[4096], s_out[4096];
+
+/** Best of repeated runs over a 4096 sample buffer, in seconds, templated so fn is inlined as in real code */
+template <unary_fn fn>
+static double time_fn(const float lo, const float hi)
+{
+  for (int i = 0; i < 4096; ++i)
+    s_in[i] = lo + (hi - lo) * i / 4096;
+  double best = 1e9;
+  for (int r = 0; r < 200; ++r) {
+    const clock_t t0 = clock();
+    for (int k = 0; k < 10; ++k) {
+      for (int i = 0; i < 4096; ++i)
+        s_out[i] = fn(s_in[i]);
+      __asm__ volatile("" : : "r"(s_out) : "memory");
+    }
+    best = fmin(best, (double)(clock() - t0) / CLOCKS_PER_SEC);
+  }
+  return best;
+}
+
+/** Documented errors are rounded to two digits, allow for that */
+template <unary_fn fn, unary_fn libm>
+static void check_tier(const char *name, const double err, const double documented,
+                       const float lo, const float hi)
+{
+  char what[64];
+  snprintf(what, sizeof(what), "%s within %.1e", name, documented);
+  check(err <= documented * 1.05, what, err);
+  printf("  %-40s      ~%.1fx libm\n", "", time_fn<libm>(lo, hi) / time_fn<fn>(lo, hi));
+}
+
+static float libm_exp2f(float x) { return exp2f(x); }
+static float libm_log2f(float x) { return log2f(x); }
+static float libm_sinf(float x) { return sinf(x); }
+
+static void check_tiers(void)
+{
+  printf("approximation tiers\n");
+  check_tier<pow2f_o2, libm_exp2f>("pow2f_o2 rel.", max_rel_pow2(pow2f_o2), 1.7e-3, -10.f, 10.f);
+  check_tier<pow2f_o3, libm_exp2f>("pow2f_o3 rel.", max_rel_pow2(pow2f_o3), 7.5e-5, -10.f, 10.f);
+  check_tier<pow2f_o5, libm_exp2f>("pow2f_o5 rel.", max_rel_pow2(pow2f_o5), 1.8e-7, -10.f, 10.f);
+  check_tier<log2f_o3, libm_log2f>("log2f_o3 abs.", max_abs_log2(log2f_o3), 1.3e-3, 1e-3f, 1e3f);
+  check_tier<log2f_o4, libm_log2f>("log2f_o4 abs.", max_abs_log2(log2f_o4), 1.8e-4, 1e-3f, 1e3f);
+  check_tier<log2f_o6, libm_log2f>("log2f_o6 abs.", max_abs_log2(log2f_o6), 4.2e-6, 1e-3f, 1e3f);
+  check_tier<sinf_o3, libm_sinf>("sinf_o3 abs.", max_abs_sin(sinf_o3), 4.5e-3, -M_PI, M_PI);
+  check_tier<sinf_o5, libm_sinf>("sinf_o5 abs.", max_abs_sin(sinf_o5), 6.8e-5, -M_PI, M_PI);
+  check_tier<sinf_o7, libm_sinf>("sinf_o7 abs.", max_abs_sin(sinf_o7), 7.7e-7, -M_PI, M_PI);
+}
+
+// -----------------------------------------------------------------------------
+// Block approximations, max error over the whole buffer, covering the unrolled and tail
+// loops, and speedup against per-sample libm calls over 64 sample blocks as documented
+
+typedef void (*block_fn)(const float *, float *, size_t);
+
+static float s_bx[4099], s_by[4099];
+
+/** Best of repeated runs over 64 sample blocks, in seconds */
+template <block_fn fn>
+static double time_block(void)
+{
+  double best = 1e9;
+  for (int r = 0; r < 200; ++r) {
+    const clock_t t0 = clock();
+    for (int k = 0; k < 640; ++k) {
+      fn(&s_bx[(k & 63) * 64], s_by, 64);
+      __asm__ volatile("" : : "r"(s_by) : "memory");
+    }
+    best = fmin(best, (double)(clock() - t0) / CLOCKS_PER_SEC);
+  }
+  return best;
+}
+
+template <unary_fn libm>
+static void libm_block(const float *x, float *y, size_t len)
+{
+  for (size_t i = 0; i < len; ++i)
+    y[i] = libm(x[i]);
+}
+
+/** Inputs are spread linearly over [lo, hi], or logarithmically for log2 */
+template <block_fn fn, unary_fn libm>
+static void check_block(const char *name, const bool rel, const bool logspaced,
+                        const double documented, const float lo, const float hi)
+{
+  for (int i = 0; i < 4099; ++i)
+    s_bx[i] = logspaced ? (float)(lo * pow((double)hi / lo, i / 4098.0)) : lo + (hi - lo) * i / 4098;
+  fn(s_bx, s_by, 4099);
+  double e = 0;
+  for (int i = 0; i < 4099; ++i) {
+    const double ref = libm(s_bx[i]);
+    e = fmax(e, rel ? fabs(s_by[i] / ref - 1.0) : fabs(s_by[i] - ref));
+  }
+  char what[64];
+  snprintf(what, sizeof(what), "%s %s within %.1e", name, rel ? "rel." : "abs.", documented);
+  check(e <= documented * 1.05, what, e);
+  printf("  %-40s      ~%.1fx libm\n", "", time_block<libm_block<libm> >() / time_block<fn>());
+}
+
+static float libm_expf(float x) { return expf(x); }
+static float libm_tanhf(float x) { return tanhf(x); }
+
+static void check_blocks(void)
+{
+  printf("block approximations\n");
+  check_block<fastpow2f_block, libm_exp2f>("fastpow2f_block", true, false, 6.0e-5, -10.f, 10.f);
+  check_block<fasterpow2f_block, libm_exp2f>("fasterpow2f_block", true, false, 3.9e-2, -10.f, 10.f);
+  check_block<fastexpf_block, libm_expf>("fastexpf_block", true, false, 6.0e-5, -10.f, 10.f);
+  check_block<fasterexpf_block, libm_expf>("fasterexpf_block", true, false, 3.9e-2, -10.f, 10.f);
+  check_block<fastlog2f_block, libm_log2f>("fastlog2f_block", false, true, 1.7e-4, 1e-3f, 1e3f);
+  check_block<fasterlog2f_block, libm_log2f>("fasterlog2f_block", false, true, 5.7e-2, 1e-3f, 1e3f);
+  check_block<fastsinfullf_block, libm_sinf>("fastsinfullf_block", false, false, 4.3e-5, -4 * M_PI, 4 * M_PI);
+  check_block<fastersinfullf_block, libm_sinf>("fastersinfullf_block", false, false, 8.9e-4, -4 * M_PI, 4 * M_PI);
+  check_block<fastertanhf_block, libm_tanhf>("fastertanhf_block", false, false, 2.8e-5, -3.f, 3.f);
+}
+
+// -----------------------------------------------------------------------------
+// dB conversion floor, amplitudes of 0 and below have no log
+
+static void check_ampdb(void)
+{
+  printf("ampdbf\n");
+  check(ampdbf(0.f) == -999.f, "ampdbf(0) == -999", ampdbf(0.f));
+  check(ampdbf(-1.f) == -999.f, "ampdbf(-1) == -999", ampdbf(-1.f));
+  check(fabs(ampdbf(1.f)) < 1.1e-3, "ampdbf(1) == 0", ampdbf(1.f));
+  check(fabs(ampdbf(0.001f) + 60.0) < 1.1e-3, "ampdbf(0.001) == -60", ampdbf(0.001f));
+}
+
+int main(void)
+{
+  check_sat();
+  check_tiers();
+  check_blocks();
+  check_ampdb();
+  printf("%s\n", s_failed ? "FAILED" : "passed");
+  return s_failed ? 1 : 0;
+}
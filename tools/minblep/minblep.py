@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Minimum phase band-limited step (minBLEP) residual table generator.
+
+Generates a C header with the residual of a minimum phase band-limited step
+against an ideal step, sampled at a fixed oversampling factor, for use by
+dsp::VAOsc. Only uses the Python standard library.
+
+Method: windowed sinc -> real cepstrum -> minimum phase reconstruction ->
+integration (E. Brandt, "Hard Sync Without Aliasing", ICMC 2001).
+"""
+
+import argparse
+import cmath
+import math
+import sys
+
+
+def fft(x, inverse=False):
+    """Iterative radix-2 FFT, len(x) must be a power of two."""
+    n = len(x)
+    a = list(x)
+    j = 0
+    for i in range(1, n):
+        bit = n >> 1
+        while j & bit:
+            j ^= bit
+            bit >>= 1
+        j |= bit
+        if i < j:
+            a[i], a[j] = a[j], a[i]
+    size = 2
+    sign = 1.0 if inverse else -1.0
+    while size <= n:
+        w_step = cmath.exp(sign * 2j * math.pi / size)
+        half = size >> 1
+        for start in range(0, n, size):
+            w = 1.0
+            for k in range(half):
+                u = a[start + k]
+                v = a[start + k + half] * w
+                a[start + k] = u + v
+                a[start + k + half] = u - v
+                w *= w_step
+        size <<= 1
+    if inverse:
+        a = [v / n for v in a]
+    return a
+
+
+def blackman(n, length):
+    t = 2.0 * math.pi * n / (length - 1)
+    return 0.42 - 0.5 * math.cos(t) + 0.08 * math.cos(2.0 * t)
+
+
+def minblep(zero_crossings, oversampling, cutoff):
+    """Return minBLEP step response of zero_crossings * oversampling + 1 points, from 0 to 1."""
+    length = zero_crossings * oversampling + 1
+    half = (length - 1) / 2.0
+
+    # Windowed sinc, zero crossings spaced by oversampling/cutoff points
+    impulse = []
+    for n in range(length):
+        t = (n - half) / oversampling * cutoff
+        s = 1.0 if t == 0 else math.sin(math.pi * t) / (math.pi * t)
+        impulse.append(s * blackman(n, length))
+
+    # Real cepstrum
+    size = 1
+    while size < 8 * length:
+        size <<= 1
+    spec = fft(impulse + [0.0] * (size - length))
+    logmag = [math.log(max(abs(v), 1e-100)) for v in spec]
+    ceps = [v.real for v in fft(logmag, inverse=True)]
+
+    # Fold to causal cepstrum
+    folded = [0.0] * size
+    folded[0] = ceps[0]
+    for n in range(1, size // 2):
+        folded[n] = 2.0 * ceps[n]
+    folded[size // 2] = ceps[size // 2]
+
+    # Minimum phase impulse response
+    minspec = [cmath.exp(v) for v in fft(folded)]
+    minimp = [v.real for v in fft(minspec, inverse=True)][:length]
+
+    # Integrate and normalize to a unit step
+    step = []
+    acc = 0.0
+    for v in minimp:
+        acc += v
+        step.append(acc)
+    return [v / acc for v in step]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('-z', '--zero-crossings', type=int, default=16,
+                        help='length of the step in samples (default: 16)')
+    parser.add_argument('-s', '--oversampling', type=int, default=32,
+                        help='table points per sample (default: 32)')
+    parser.add_argument('-c', '--cutoff', type=float, default=0.9,
+                        help='cutoff relative to Nyquist (default: 0.9)')
+    parser.add_argument('-o', '--output', default='-',
+                        help='output header path (default: stdout)')
+    args = parser.parse_args()
+
+    step = minblep(args.zero_crossings, args.oversampling, args.cutoff)
+    residual = [v - 1.0 for v in step]
+    residual[-1] = 0.0  # guard point, step fully settled
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w')
+    out.write('#pragma once\n')
+    out.write('/*\n')
+    out.write(' * minBLEP residual table for dsp::VAOsc, generated by tools/minblep/minblep.py\n')
+    out.write(' * %s\n' % ' '.join(['minblep.py', '-z', str(args.zero_crossings),
+                                   '-s', str(args.oversampling), '-c', str(args.cutoff)]))
+    out.write(' *\n')
+    out.write(' * Entry k is (minBLEP step - 1) at k/%d samples after the discontinuity.\n' % args.oversampling)
+    out.write(' */\n\n')
+    out.write('#define k_minblep_zero_crossings (%d)\n' % args.zero_crossings)
+    out.write('#define k_minblep_oversampling   (%d)\n' % args.oversampling)
+    out.write('#define k_minblep_lut_size       (k_minblep_zero_crossings * k_minblep_oversampling + 1)\n\n')
+    # Minus the residual's integral, the minimum phase step lags the ideal one by this much on average
+    delay = -(sum(residual) - 0.5 * (residual[0] + residual[-1])) / args.oversampling
+    out.write('/** Group delay of the minBLEP step in samples, i.e. minus the integral of the residual */\n')
+    out.write('#define k_minblep_delay          (%.8ef)\n\n' % delay)
+    out.write('static const float minblep_lut_f[k_minblep_lut_size] = {\n')
+    for i in range(0, len(residual), 6):
+        out.write('  ' + ' '.join('%.8ef,' % v for v in residual[i:i + 6]) + '\n')
+    out.write('};\n')
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
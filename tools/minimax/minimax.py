@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Minimax polynomial fits for the approximation tiers of float_math.h.
+
+Runs the Remez exchange algorithm over a dense grid to find the polynomial of
+a given order minimizing the maximum (weighted) error, and prints its
+coefficients in ascending order as used by pow2f_oN(), log2f_oN() and
+sinf_oN(). Only uses the Python standard library.
+
+  pow2: 2^f for f in [0, 1], relative error, P(f) = c0 + c1 f + ... + cN f^N
+  log2: log2(1 + t) for 1 + t in [sqrt(1/2), sqrt(2)), relative error,
+        t * Q(t) with Q(t) = c0 + c1 t + ... + c(N-1) t^(N-1)
+  sin:  sin(2 pi t) for t in [0, 0.25], absolute error, odd powers only,
+        t * (c1 + c3 t^2 + ... + cN t^(N-1))
+"""
+
+import argparse
+import math
+
+
+def solve(a, b):
+    """Gauss-Jordan elimination with partial pivoting."""
+    n = len(a)
+    m = [row[:] + [v] for row, v in zip(a, b)]
+    for i in range(n):
+        p = max(range(i, n), key=lambda r: abs(m[r][i]))
+        m[i], m[p] = m[p], m[i]
+        for r in range(n):
+            if r != i:
+                f = m[r][i] / m[i][i]
+                for c in range(i, n + 1):
+                    m[r][c] -= f * m[i][c]
+    return [m[i][n] / m[i][i] for i in range(n)]
+
+
+def remez(f, basis, a, b, w=lambda x: 1.0, iters=30, grid=20000):
+    """Coefficients over basis minimizing max |w(x) (f(x) - P(x))| on [a, b], and that error."""
+    n = len(basis)
+    xs = [(a + b) / 2 - (b - a) / 2 * math.cos(math.pi * i / n) for i in range(n + 1)]
+    grid_x = [a + (b - a) * i / grid for i in range(grid + 1)]
+    ev = []
+    for _ in range(iters):
+        rows = [[phi(x) for phi in basis] + [(-1) ** i / w(x)] for i, x in enumerate(xs)]
+        c = solve(rows, [f(x) for x in xs])[:n]
+        ev = [w(x) * (f(x) - sum(ci * phi(x) for ci, phi in zip(c, basis))) for x in grid_x]
+        # Extremum of each run of equal error sign becomes the next reference
+        runs, cur = [], [0]
+        for i in range(1, len(grid_x)):
+            if (ev[i] >= 0) == (ev[cur[0]] >= 0):
+                cur.append(i)
+            else:
+                runs.append(cur)
+                cur = [i]
+        runs.append(cur)
+        ext = [max(r, key=lambda i: abs(ev[i])) for r in runs]
+        while len(ext) > n + 1:
+            if abs(ev[ext[0]]) < abs(ev[ext[-1]]):
+                ext.pop(0)
+            else:
+                ext.pop()
+        if len(ext) < n + 1:
+            break
+        xs = [grid_x[i] for i in ext]
+    return c, max(abs(e) for e in ev)
+
+
+def power(k):
+    return lambda x: x ** k
+
+
+def fit(func, order):
+    if func == 'pow2':
+        return remez(lambda x: 2 ** x, [power(k) for k in range(order + 1)], 0, 1,
+                     w=lambda x: 2 ** -x)
+    if func == 'log2':
+        # Fit Q(t) = log2(1 + t) / t with relative weight, avoiding the 0/0 at t = 0
+        q = lambda t: math.log2(1 + t) / t if abs(t) > 1e-12 else 1 / math.log(2)
+        return remez(q, [power(k) for k in range(order)], math.sqrt(0.5) - 1,
+                     math.sqrt(2) - 1, w=lambda t: 1 / q(t), grid=40000)
+    if func == 'sin':
+        return remez(lambda t: math.sin(2 * math.pi * t),
+                     [power(k) for k in range(1, order + 1, 2)], 1e-9, 0.25)
+    raise ValueError(func)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('-f', '--func', choices=('pow2', 'log2', 'sin'), required=True,
+                        help='function to fit')
+    parser.add_argument('-n', '--order', type=int, required=True, help='polynomial order')
+    args = parser.parse_args()
+
+    if args.func == 'sin' and args.order % 2 == 0:
+        parser.error('sin fits use odd orders')
+    coeffs, err = fit(args.func, args.order)
+    print('%s order %d, fit error %.3g %s' % (args.func, args.order, err,
+                                              'abs.' if args.func == 'sin' else 'rel.'))
+    print(', '.join('%.9gf' % c for c in coeffs))
+
+
+if __name__ == '__main__':
+    main()
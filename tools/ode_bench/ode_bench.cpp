@@ -0,0 +1,218 @@
+/*
+ * Host checks and cost table for the ODE models and integrators of inc/dsp/ode.hpp.
+ *
+ * Build and run against one platform's headers, see README.md:
+ *   g++ -O2 -std=c++11 -I../mathcheck/host -I../../platform/prologue/inc/utils \
+ *       -I../../platform/prologue/inc/dsp ode_bench.cpp -o ode_bench && ./ode_bench
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <initializer_list>
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#include "float_math.h"
+#include "ode.hpp"
+
+using namespace dsp;
+
+// Outputs hold frames * Factor samples, for the 2x variants too
+static float s_in[64], s_out[64 * 2];
+
+// -----------------------------------------------------------------------------
+// Diode ladder, linear response and self-oscillation
+
+/** Steady state peak gain for a small sine at normalized frequency f */
+template <typename I, uint32_t F>
+static double ladder_gain(const double wc, const double k, const double f, const double amp = 0.01)
+{
+  OdeFilter<OdeDiodeLadder, I, F> fl;
+  fl.setW0(wc);
+  fl.model().setResonance(k);
+  double ph = 0, pk = 0;
+  for (int b = 0; b < 1500; ++b) {
+    for (int i = 0; i < 64; ++i) {
+      s_in[i] = amp * sin(ph);
+      ph += 2 * M_PI * f;
+    }
+    fl.process_block(s_in, s_out, 64);
+    if (b > 1000)
+      for (int i = 0; i < 64; ++i)
+        pk = fmax(pk, fabs(s_out[i]));
+  }
+  return pk / amp;
+}
+
+/** Peak amplitude and normalized frequency from zero crossings with no input, from a small kick */
+template <typename I, uint32_t F>
+static double ladder_selfosc(const double wc, const double k, double *freq)
+{
+  OdeFilter<OdeDiodeLadder, I, F> fl;
+  fl.setW0(wc);
+  fl.model().setResonance(k);
+  fl.state()[0] = 0.01f;
+  double pk = 0;
+  int zc = 0;
+  float prev = 0;
+  for (int i = 0; i < 64; ++i)
+    s_in[i] = 0;
+  for (int b = 0; b < 3000; ++b) {
+    fl.process_block(s_in, s_out, 64);
+    if (b > 2000)
+      for (int i = 0; i < 64; ++i) {
+        pk = fmax(pk, fabs(s_out[i]));
+        if (prev < 0 && s_out[i] >= 0)
+          ++zc;
+        prev = s_out[i];
+      }
+  }
+  *freq = zc / (1000. * 64);
+  return pk;
+}
+
+static void check_ladder(void)
+{
+  const double fc = 1000. / 48000;
+  printf("ladder, 1kHz cutoff\n");
+  printf("  DC gain trap1 k=0 %.3f (1), k=3 %.3f (0.25)\n",
+         ladder_gain<OdeTrapezoidal<1>, 1>(fc, 0, 1e-4), ladder_gain<OdeTrapezoidal<1>, 1>(fc, 3, 1e-4));
+  for (const double f : { 250., 1000., 4000. })
+    printf("  k=0 gain at %5.0fHz: trap1 %.4f rk4 %.4f trap1 2x %.4f\n", f,
+           ladder_gain<OdeTrapezoidal<1>, 1>(fc, 0, f / 48000), ladder_gain<OdeRK4, 1>(fc, 0, f / 48000),
+           ladder_gain<OdeTrapezoidal<1>, 2>(fc, 0, f / 48000));
+  for (const double k : { 10., 14., 16., 17., 18., 20., 30. }) {
+    double fq;
+    const double a = ladder_selfosc<OdeTrapezoidal<1>, 1>(fc, k, &fq);
+    printf("  self-oscillation k=%2.0f: amp %.3f freq %.0fHz\n", k, a, fq * 48000);
+  }
+  printf("ladder, high cutoff, k=20\n");
+  for (const double fch : { 8000., 16000. }) {
+    double f1, f2, f3;
+    const double a1 = ladder_selfosc<OdeTrapezoidal<1>, 1>(fch / 48000, 20, &f1);
+    const double a2 = ladder_selfosc<OdeRK4, 1>(fch / 48000, 20, &f2);
+    const double a3 = ladder_selfosc<OdeTrapezoidal<1>, 2>(fch / 48000, 20, &f3);
+    printf("  %5.0fHz: trap1 amp %.3f f %.0f | rk4 amp %.3g f %.0f | trap1 2x amp %.3f f %.0f\n",
+           fch, a1, f1 * 48000, a2, f2 * 48000, a3, f3 * 48000);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Lorenz must stay on the attractor, Duffing must stay bounded when driven
+
+template <typename I>
+static void check_lorenz(const char *name)
+{
+  OdeOsc<OdeLorenz, I, 1> o;
+  o.model().setRate(0.01f);
+  const float x0[3] = { 1, 1, 20 };
+  o.reset(x0);
+  double mx = 0, mz = 0;
+  bool finite = true;
+  for (int r = 0; r < 20000; ++r) {
+    o.process_block(s_out, 64);
+    for (int i = 0; i < 64; ++i) {
+      finite &= std::isfinite(s_out[i]);
+      mx = fmax(mx, fabs(s_out[i]));
+    }
+    mz = fmax(mz, o.state()[2]);
+  }
+  printf("  %-6s rate 0.01: max |x| %.1f max z %.1f%s\n", name, mx, mz, finite ? "" : " NOT FINITE");
+}
+
+static void check_duffing(void)
+{
+  OdeFilter<OdeDuffing, OdeTrapezoidal<1>, 1> d;
+  d.setW0(200. / 48000);
+  d.model().setDamping(0.001f);
+  d.model().setStiffness(1.f);
+  double ph = 0, mx = 0;
+  for (int b = 0; b < 2000; ++b) {
+    for (int i = 0; i < 64; ++i) {
+      s_in[i] = 0.002 * sin(ph);
+      ph += 2 * M_PI * 210 / 48000;
+    }
+    d.process_block(s_in, s_out, 64);
+    if (b > 1000)
+      for (int i = 0; i < 64; ++i)
+        mx = fmax(mx, fabs(s_out[i]));
+  }
+  printf("duffing\n  driven at 210Hz, 200Hz resonance: amp %.3f\n", mx);
+}
+
+// -----------------------------------------------------------------------------
+// Cost per sample, templated so model and integrator are inlined as in real code
+
+template <typename M, typename I, uint32_t F>
+static double cost_filter(const M &init)
+{
+  OdeFilter<M, I, F> fl;
+  fl.model() = init;
+  for (int i = 0; i < 64; ++i)
+    s_in[i] = 0.3f * sin(i * 0.3);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < 50000; ++r) {
+    fl.process_block(s_in, s_out, 64);
+    __asm__ volatile("" : : "r"(s_out) : "memory");
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / (50000 * 64.);
+}
+
+template <typename M, typename I, uint32_t F>
+static double cost_osc(const M &init, const float *x0)
+{
+  OdeOsc<M, I, F> o;
+  o.model() = init;
+  o.reset(x0);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < 50000; ++r) {
+    o.process_block(s_out, 64);
+    __asm__ volatile("" : : "r"(s_out) : "memory");
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / (50000 * 64.);
+}
+
+#define COST_ROW(name, fn, M, init, ...)                                     \
+  printf("  %-8s %7.1f %7.1f %7.1f %7.1f %7.1f | %7.1f\n", name,             \
+         fn<M, OdeSemiImplicitEuler, 1>(init, ##__VA_ARGS__),              \
+         fn<M, OdeRK2, 1>(init, ##__VA_ARGS__),                            \
+         fn<M, OdeRK4, 1>(init, ##__VA_ARGS__),                            \
+         fn<M, OdeTrapezoidal<1>, 1>(init, ##__VA_ARGS__),                 \
+         fn<M, OdeTrapezoidal<2>, 1>(init, ##__VA_ARGS__),                 \
+         fn<M, OdeTrapezoidal<1>, 2>(init, ##__VA_ARGS__))
+
+static void cost_table(void)
+{
+  const float x2[2] = { 1, 0 }, x3[3] = { 1, 1, 20 };
+  const OdeVanDerPol vdp(2 * M_PI * 440 / 48000, 1000. / 48000);
+  const OdeLorenz lz(10, 28, 8. / 3, 0.01f);
+  const OdeDuffing df(2 * M_PI * 200 / 48000, 0.001f, 1.f);
+  const OdeDiodeLadder dl(2 * M_PI * 1000. / 48000, 10);
+  printf("cost, ns/sample\n");
+  printf("  %-8s %7s %7s %7s %7s %7s | %7s\n", "", "Euler", "RK2", "RK4", "trap1", "trap2", "trap1 2x");
+  COST_ROW("vdpol", cost_osc, OdeVanDerPol, vdp, x2);
+  COST_ROW("lorenz", cost_osc, OdeLorenz, lz, x3);
+  COST_ROW("duffing", cost_filter, OdeDuffing, df);
+  COST_ROW("ladder", cost_filter, OdeDiodeLadder, dl);
+}
+
+int main(void)
+{
+#if defined(__SSE__)
+  // Flush denormals as the Cortex-M4 FPU does in the firmware
+  _mm_setcsr(_mm_getcsr() | 0x8040);
+#endif
+  check_ladder();
+  printf("lorenz\n");
+  check_lorenz<OdeSemiImplicitEuler>("Euler");
+  check_lorenz<OdeRK2>("RK2");
+  check_lorenz<OdeRK4>("RK4");
+  check_lorenz<OdeTrapezoidal<1> >("trap1");
+  check_duffing();
+  cost_table();
+  return 0;
+}
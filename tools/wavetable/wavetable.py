@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""Band-limited mipmapped wavetable generator.
+
+Turns single cycle waveforms (WAV files or built-in shapes) into a C header
+of per-octave band-limited mipmaps for use by dsp::Wavetable. Only uses the
+Python standard library.
+
+Each input frame is resampled to the table size in the frequency domain, its
+DC removed, and for each mip level l all harmonics above (size / 2) >> l are
+discarded, so level l can be played without aliasing up to
+samplerate / (size >> l). Each level is followed by a guard point equal to
+its first point, so that interpolation never needs to wrap the index.
+"""
+
+import argparse
+import cmath
+import math
+import struct
+import sys
+import wave
+
+
+def fft(x, inverse=False):
+    """Iterative radix-2 FFT, len(x) must be a power of two."""
+    n = len(x)
+    a = list(x)
+    j = 0
+    for i in range(1, n):
+        bit = n >> 1
+        while j & bit:
+            j ^= bit
+            bit >>= 1
+        j |= bit
+        if i < j:
+            a[i], a[j] = a[j], a[i]
+    size = 2
+    sign = 1.0 if inverse else -1.0
+    while size <= n:
+        w_step = cmath.exp(sign * 2j * math.pi / size)
+        half = size >> 1
+        for start in range(0, n, size):
+            w = 1.0
+            for k in range(half):
+                u = a[start + k]
+                v = a[start + k + half] * w
+                a[start + k] = u + v
+                a[start + k + half] = u - v
+                w *= w_step
+        size <<= 1
+    if inverse:
+        a = [v / n for v in a]
+    return a
+
+
+def spectrum(frame, harmonics):
+    """Return complex amplitudes of harmonics 0..harmonics of a cycle of any length."""
+    n = len(frame)
+    if n & (n - 1) == 0 and n >= 2 * harmonics:
+        return fft(frame)[:harmonics + 1]
+    # Plain DFT for non power of two cycle lengths
+    out = []
+    for k in range(min(harmonics, n // 2) + 1):
+        w = -2j * math.pi * k / n
+        out.append(sum(v * cmath.exp(w * i) for i, v in enumerate(frame)))
+    return out + [0j] * (harmonics + 1 - len(out))
+
+
+def read_wav(path, cycle):
+    """Read first channel of a PCM WAV file, split in frames of cycle samples (whole file if 0)."""
+    w = wave.open(path, 'rb')
+    width = w.getsampwidth()
+    channels = w.getnchannels()
+    raw = w.readframes(w.getnframes())
+    w.close()
+    step = width * channels
+    samples = []
+    for i in range(0, len(raw) - step + 1, step):
+        b = raw[i:i + width]
+        if width == 1:
+            v = (b[0] - 128) / 128.0
+        elif width == 2:
+            v = struct.unpack('<h', b)[0] / 32768.0
+        elif width == 3:
+            v = (int.from_bytes(b, 'little', signed=True)) / 8388608.0
+        elif width == 4:
+            v = struct.unpack('<i', b)[0] / 2147483648.0
+        else:
+            raise ValueError('%s: unsupported sample width %d' % (path, width))
+        samples.append(v)
+    if cycle <= 0:
+        return [samples]
+    return [samples[i:i + cycle] for i in range(0, len(samples) - cycle + 1, cycle)]
+
+
+def builtin(name, size):
+    """Built-in naive single cycle shapes, band-limited later like any input."""
+    shapes = {
+        'sine': lambda t: math.sin(2.0 * math.pi * t),
+        'saw': lambda t: 1.0 - 2.0 * t,
+        'square': lambda t: 1.0 if t < 0.5 else -1.0,
+        'triangle': lambda t: 4.0 * t - 1.0 if t < 0.5 else 3.0 - 4.0 * t,
+    }
+    if name not in shapes:
+        raise ValueError('unknown shape %s, expected one of %s' % (name, ', '.join(sorted(shapes))))
+    # Oversample the naive shape so the kept harmonics are accurate
+    n = 16 * size
+    return [shapes[name]((i + 0.5) / n) for i in range(n)]
+
+
+def mipmaps(frame, size, levels):
+    """Return levels band-limited copies of frame resampled to size points."""
+    half = size // 2
+    spec = spectrum(frame, half)
+    scale = float(size) / len(frame)
+    maps = []
+    for l in range(levels):
+        top = half >> l
+        bins = [0j] * size
+        for k in range(1, top + 1):
+            v = spec[k] * scale
+            if k == half:
+                bins[k] = complex(v.real, 0.0)
+            else:
+                bins[k] = v
+                bins[size - k] = v.conjugate()
+        maps.append([v.real for v in fft(bins, inverse=True)])
+    return maps
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('inputs', nargs='+',
+                        help='WAV files or built-in shapes (sine, saw, square, triangle), one or more frames each')
+    parser.add_argument('-n', '--name', default='wavetable',
+                        help='C identifier prefix (default: wavetable)')
+    parser.add_argument('-s', '--size-exp', type=int, default=8,
+                        help='log2 of points per cycle (default: 8)')
+    parser.add_argument('-l', '--levels', type=int, default=0,
+                        help='number of mip levels (default: size exponent, down to a single harmonic)')
+    parser.add_argument('-c', '--cycle', type=int, default=0,
+                        help='WAV samples per cycle, to split files into frames (default: whole file is one cycle)')
+    parser.add_argument('-f', '--format', choices=['int16', 'float'], default='int16',
+                        help='sample format (default: int16)')
+    parser.add_argument('-o', '--output', default='-',
+                        help='output header path (default: stdout)')
+    args = parser.parse_args()
+
+    size = 1 << args.size_exp
+    levels = args.levels if args.levels > 0 else args.size_exp
+    if levels > args.size_exp:
+        parser.error('at most %d levels for %d point cycles' % (args.size_exp, size))
+
+    frames = []
+    for src in args.inputs:
+        if src.lower().endswith('.wav'):
+            frames += read_wav(src, args.cycle)
+        else:
+            frames.append(builtin(src, size))
+    if not frames:
+        parser.error('no input frames')
+
+    tables = [mipmaps(f, size, levels) for f in frames]
+
+    # Normalize all frames and levels together so morphing keeps relative levels,
+    # peak is 32767/32768 in both formats so that full scale maps to Q31 without overflow
+    peak = max(abs(v) for t in tables for m in t for v in m) or 1.0
+    gain = (32767.0 if args.format == 'int16' else 32767.0 / 32768.0) / peak
+
+    ctype = 'int16_t' if args.format == 'int16' else 'float'
+    n = args.name
+    out = sys.stdout if args.output == '-' else open(args.output, 'w')
+    out.write('#pragma once\n')
+    out.write('/*\n')
+    out.write(' * Band-limited wavetable for dsp::Wavetable, generated by tools/wavetable/wavetable.py\n')
+    out.write(' * %s\n' % ' '.join(['wavetable.py'] + sys.argv[1:]))
+    out.write(' *\n')
+    out.write(' * Layout: [frame][level][point], level l keeps harmonics up to %d >> l,\n' % (size // 2))
+    out.write(' * point k_%s_size of each level is a guard point equal to point 0.\n' % n)
+    out.write(' */\n\n')
+    out.write('#include <stdint.h>\n\n')
+    out.write('#define k_%s_size_exp (%d)\n' % (n, args.size_exp))
+    out.write('#define k_%s_size     (1U<<k_%s_size_exp)\n' % (n, n))
+    out.write('#define k_%s_levels   (%d)\n' % (n, levels))
+    out.write('#define k_%s_frames   (%d)\n\n' % (n, len(tables)))
+    out.write('static const %s %s_data[k_%s_frames * k_%s_levels * (k_%s_size + 1)] = {\n' % (ctype, n, n, n, n))
+    for f, t in enumerate(tables):
+        for l, m in enumerate(t):
+            m = m + m[:1]
+            out.write('  // frame %d, level %d\n' % (f, l))
+            if args.format == 'int16':
+                vals = ['%d,' % int(round(v * gain)) for v in m]
+                per = 12
+            else:
+                vals = ['%.8ef,' % (v * gain) for v in m]
+                per = 6
+            for i in range(0, len(vals), per):
+                out.write('  ' + ' '.join(vals[i:i + per]) + '\n')
+    out.write('};\n')
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()